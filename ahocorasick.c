@@ -0,0 +1,222 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "ahocorasick.h"
+
+/*
+This file is part of fsfuzz.
+
+Aho-Corasick automaton for searching many strings in one pass over a block. The goto-function is turned into a complete transition table by ac_compile(), so scanning is just one table lookup per byte.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define AC_NB_STATES_INITIAL 64
+
+static uint32_t ac_new_state(ac_t * const ac)
+{
+	if(ac->nb_states==ac->nb_states_allocated)
+	{
+		ac->nb_states_allocated*=2;
+		ac->next=realloc(ac->next, ac->nb_states_allocated*sizeof(uint32_t[256]));
+		ac->fail=realloc(ac->fail, ac->nb_states_allocated*sizeof(uint32_t));
+		ac->out=realloc(ac->out, ac->nb_states_allocated*sizeof(int32_t));
+		ac->out_link=realloc(ac->out_link, ac->nb_states_allocated*sizeof(uint32_t));
+		if(ac->next==NULL || ac->fail==NULL || ac->out==NULL || ac->out_link==NULL)
+			err(1, "realloc for Aho-Corasick states failed");
+	}
+
+	memset(ac->next[ac->nb_states], 0, sizeof(uint32_t[256]));
+	ac->fail[ac->nb_states]=0;
+	ac->out[ac->nb_states]=-1;
+	ac->out_link[ac->nb_states]=0;
+
+	return ac->nb_states++;
+}
+
+void ac_init(ac_t * const ac, const bool nocase)
+{
+	memset(ac, 0, sizeof(ac_t));
+	ac->nocase=nocase;
+
+	ac->nb_states_allocated=AC_NB_STATES_INITIAL;
+	ac->next=malloc(ac->nb_states_allocated*sizeof(uint32_t[256]));
+	ac->fail=malloc(ac->nb_states_allocated*sizeof(uint32_t));
+	ac->out=malloc(ac->nb_states_allocated*sizeof(int32_t));
+	ac->out_link=malloc(ac->nb_states_allocated*sizeof(uint32_t));
+	if(ac->next==NULL || ac->fail==NULL || ac->out==NULL || ac->out_link==NULL)
+		err(1, "malloc for Aho-Corasick states failed");
+
+	ac_new_state(ac); //root
+}
+
+static uint8_t ac_fold(ac_t const * const ac, const uint8_t c)
+{
+	if(ac->nocase && c>='A' && c<='Z')
+		return c+('a'-'A');
+	return c;
+}
+
+uint_fast32_t ac_add_pattern(ac_t * const ac, uint8_t const * const bytes, const uint_fast32_t nb_bytes, char const * const name, const uint_fast32_t tag)
+{
+	uint_fast32_t i;
+	uint32_t state=0;
+	uint_fast32_t id;
+
+	if(ac->compiled)
+		errx(1, "ac_add_pattern: automaton already compiled");
+
+	if(nb_bytes==0 || nb_bytes>AC_PATTERN_LEN_MAX)
+		errx(1, "ac_add_pattern: invalid pattern length %lu", nb_bytes);
+
+	for(i=0; i<nb_bytes; i++)
+	{
+		uint8_t c=ac_fold(ac, bytes[i]);
+		if(ac->next[state][c]==0)
+		{
+			uint32_t new_state=ac_new_state(ac); //may realloc, don't hold a pointer into ac->next across this call
+			ac->next[state][c]=new_state;
+		}
+		state=ac->next[state][c];
+	}
+
+	ac->patterns=realloc(ac->patterns, (ac->nb_patterns+1)*sizeof(ac_pattern_t));
+	if(ac->patterns==NULL)
+		err(1, "realloc for Aho-Corasick patterns failed");
+
+	id=ac->nb_patterns++;
+
+	ac->patterns[id].nb_bytes=nb_bytes;
+	ac->patterns[id].bytes=malloc(nb_bytes);
+	ac->patterns[id].name=strdup(name);
+	ac->patterns[id].tag=tag;
+	if(ac->patterns[id].bytes==NULL || ac->patterns[id].name==NULL)
+		err(1, "malloc for Aho-Corasick pattern failed");
+	memcpy(ac->patterns[id].bytes, bytes, nb_bytes);
+
+	//identical patterns end in the same state, chain them
+	ac->patterns[id].next_same=ac->out[state];
+	ac->out[state]=id;
+
+	return id;
+}
+
+void ac_compile(ac_t * const ac)
+{
+	uint32_t * queue;
+	uint_fast32_t head=0, tail=0;
+	uint_fast16_t c;
+
+	queue=malloc(ac->nb_states*sizeof(uint32_t));
+	if(queue==NULL)
+		err(1, "malloc for Aho-Corasick queue failed");
+
+	//depth 1: failure goes to root
+	for(c=0; c<256; c++)
+	{
+		uint32_t u=ac->next[0][c];
+		ac->first_byte[c]=(u!=0);
+		if(u)
+		{
+			ac->fail[u]=0;
+			queue[tail++]=u;
+		}
+	}
+
+	//BFS, rows of states not yet dequeued still only contain trie-edges (0=none)
+	while(head<tail)
+	{
+		uint32_t s=queue[head++];
+
+		for(c=0; c<256; c++)
+		{
+			uint32_t u=ac->next[s][c];
+			if(u)
+			{
+				uint32_t f=ac->next[ac->fail[s]][c];
+				ac->fail[u]=f;
+				ac->out_link[u]=(ac->out[f]>=0)?f:ac->out_link[f];
+				queue[tail++]=u;
+			}
+			else
+				ac->next[s][c]=ac->next[ac->fail[s]][c];
+		}
+	}
+
+	free(queue);
+
+	//the trie only contains lowercase letters, make uppercase ones take the same transitions - scanning stays a single lookup per byte
+	if(ac->nocase)
+	{
+		uint_fast32_t s;
+		for(s=0; s<ac->nb_states; s++)
+		{
+			for(c='A'; c<='Z'; c++)
+				ac->next[s][c]=ac->next[s][c+('a'-'A')];
+		}
+		for(c='A'; c<='Z'; c++)
+			ac->first_byte[c]=ac->first_byte[c+('a'-'A')];
+	}
+
+	ac->compiled=true;
+}
+
+void ac_scan(ac_t const * const ac, uint8_t const * const data, const uint_fast32_t from, const uint_fast32_t len, uint32_t * const state_inout, ac_callback_t callback, void * const userdata)
+{
+	uint_fast32_t i;
+	uint32_t state=(*state_inout);
+
+	for(i=from; i<len; i++)
+	{
+		if(state==0)
+		{
+			//most bytes in a block don't start any pattern, don't walk the table for them
+			while(i<len && !ac->first_byte[data[i]])
+				i++;
+			if(i==len)
+				break;
+		}
+		
+		state=ac->next[state][data[i]];
+
+		if(ac->out[state]<0 && ac->out_link[state]==0)
+			continue;
+
+		uint32_t s=(ac->out[state]>=0)?state:ac->out_link[state];
+		while(s)
+		{
+			int_fast32_t id;
+			for(id=ac->out[s]; id>=0; id=ac->patterns[id].next_same)
+				callback(&ac->patterns[id], id, i+1-ac->patterns[id].nb_bytes, userdata);
+			s=ac->out_link[s];
+		}
+	}
+
+	(*state_inout)=state;
+}
+
+void ac_free(ac_t * const ac)
+{
+	uint_fast32_t i;
+
+	for(i=0; i<ac->nb_patterns; i++)
+	{
+		free(ac->patterns[i].bytes);
+		free(ac->patterns[i].name);
+	}
+	free(ac->patterns);
+	free(ac->next);
+	free(ac->fail);
+	free(ac->out);
+	free(ac->out_link);
+
+	memset(ac, 0, sizeof(ac_t));
+}
@@ -0,0 +1,55 @@
+#ifndef __AHOCORASICK_H__
+#define __AHOCORASICK_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define AC_PATTERN_LEN_MAX 256
+
+typedef struct
+{
+	uint_fast32_t nb_bytes;
+	uint8_t * bytes;
+	char * name; //what the user wrote, for printing
+	uint_fast32_t tag; //for the caller, not used here
+	int_fast32_t next_same; //index of next pattern with identical bytes or -1
+} ac_pattern_t;
+
+typedef struct
+{
+	uint_fast32_t nb_states;
+	uint_fast32_t nb_states_allocated;
+	uint32_t (*next)[256]; //complete transition table once compiled, no failure-loop needed while scanning
+	uint32_t * fail;
+	int32_t * out; //first pattern ending in this state or -1
+	uint32_t * out_link; //next state on the suffix chain that has an output, 0 if none
+	bool first_byte[256]; //bytes leaving the root, everything else can be skipped while in root
+
+	uint_fast32_t nb_patterns;
+	ac_pattern_t * patterns;
+
+	bool nocase; //ASCII letters match regardless of case
+	bool compiled;
+} ac_t;
+
+//called for every match, pos is the offset of the first byte of the match inside the scanned data
+typedef void (*ac_callback_t)(ac_pattern_t const * const pattern, const uint_fast32_t id, const uint_fast32_t pos, void * const userdata);
+
+void ac_init(ac_t * const ac, const bool nocase);
+uint_fast32_t ac_add_pattern(ac_t * const ac, uint8_t const * const bytes, const uint_fast32_t nb_bytes, char const * const name, const uint_fast32_t tag);
+void ac_compile(ac_t * const ac);
+//scans data[from...len-1], state_inout must be 0 for a fresh start and can be kept to continue a scan later (match positions may then be negative relative to data, it's up to the caller to avoid this)
+void ac_scan(ac_t const * const ac, uint8_t const * const data, const uint_fast32_t from, const uint_fast32_t len, uint32_t * const state_inout, ac_callback_t callback, void * const userdata);
+void ac_free(ac_t * const ac);
+
+#endif
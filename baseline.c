@@ -0,0 +1,407 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "baseline.h"
+#include "hash.h"
+
+/*
+This file is part of fsfuzz.
+
+Differential scan (--baseline) of a new version of a firmware against the results of an old one. Most of a new version is the same as the old one, only moved around a bit, so both dumps are cut into chunks at places chosen by their content (a gear rolling hash like FastCDC) and not at fixed offsets: an insertion only changes the chunks around it and the ones after it are cut at the same places as before. Chunks with the same hash are compared and consecutive identical chunks become a run, which is then grown byte by byte to where the dumps really start to differ.
+
+user_decrypt_block() only sees the block, so a block that lies entirely inside a run decrypts to the same data as in the old dump and gives the same results. These offsets are not scanned again, their results are taken from the old JSONL output instead. The blocks overlapping the start or the end of a run are scanned like everything that changed.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define CDC_SIZE_MIN 2048
+#define CDC_SIZE_MAX 65536
+#define CDC_MASK 0xFFF8000000000000ULL //13 bits, 8kB per chunk on average
+#define NB_RECORDS_INITIAL 1024
+
+typedef struct
+{
+	uint_fast32_t offset;
+	uint_fast32_t len;
+	uint64_t hash;
+} chunk_t;
+
+typedef struct
+{
+	uint_fast32_t offset;
+	char * line;
+} old_record_t;
+
+static uint64_t gear[256];
+
+static void gear_init(void)
+{
+	uint_fast16_t i;
+
+	for(i=0; i<256; i++)
+		gear[i]=xxh64(&i, sizeof(i), 0);
+}
+
+static uint8_t * load_file(char const * const filename, size_t * const size)
+{
+	FILE * f=fopen(filename, "rb");
+	if(f==NULL)
+		err(1, "can't open \"%s\"", filename);
+	if(fseek(f, 0, SEEK_END))
+		err(1, "fseek to end of \"%s\" failed", filename);
+	(*size)=ftell(f);
+	if(fseek(f, 0, SEEK_SET))
+		err(1, "fseek to beginning of \"%s\" failed", filename);
+	uint8_t * data=malloc((*size)?(*size):1);
+	if(data==NULL)
+		err(1, "malloc for \"%s\" failed", filename);
+	if((*size) && fread(data, (*size), 1, f)!=1)
+		err(1, "fread for \"%s\" failed", filename);
+	fclose(f);
+
+	return data;
+}
+
+static chunk_t * make_chunks(uint8_t const * const data, const size_t size, uint_fast32_t * const nb_chunks)
+{
+	chunk_t * chunks=malloc((size/CDC_SIZE_MIN+1)*sizeof(chunk_t));
+	if(chunks==NULL)
+		err(1, "malloc for chunks failed");
+
+	size_t pos=0;
+	(*nb_chunks)=0;
+
+	while(pos<size)
+	{
+		const size_t len_max=(size-pos<CDC_SIZE_MAX)?(size-pos):CDC_SIZE_MAX;
+		size_t len;
+		uint64_t h=0;
+
+		//the hash only depends on the last 64 bytes, no need to start before
+		for(len=(CDC_SIZE_MIN>64)?(CDC_SIZE_MIN-64):0; len<len_max; len++)
+		{
+			h=(h<<1)+gear[data[pos+len]];
+			if(len+1>=CDC_SIZE_MIN && (h&CDC_MASK)==0)
+			{
+				len++;
+				break;
+			}
+		}
+		if(len>len_max) //end of the data, shorter than CDC_SIZE_MIN
+			len=len_max;
+
+		chunks[*nb_chunks].offset=pos;
+		chunks[*nb_chunks].len=len;
+		chunks[*nb_chunks].hash=xxh64(&data[pos], len, 0);
+		(*nb_chunks)++;
+		pos+=len;
+	}
+
+	return chunks;
+}
+
+//open addressing, an entry is the index of a chunk plus 1
+static uint32_t * make_table(chunk_t const * const chunks, const uint_fast32_t nb_chunks, uint64_t * const mask)
+{
+	uint64_t sz_table=1;
+	uint_fast32_t i;
+
+	while(sz_table<2*(uint64_t)nb_chunks)
+		sz_table<<=1;
+	(*mask)=sz_table-1;
+
+	uint32_t * table=calloc(sz_table, sizeof(uint32_t));
+	if(table==NULL)
+		err(1, "calloc for chunk table failed");
+
+	for(i=0; i<nb_chunks; i++)
+	{
+		uint64_t pos=chunks[i].hash&(*mask);
+		while(table[pos])
+			pos=(pos+1)&(*mask);
+		table[pos]=i+1;
+	}
+
+	return table;
+}
+
+static bool find_chunk(uint8_t const * const old, chunk_t const * const old_chunks, uint32_t const * const table, const uint64_t mask, uint8_t const * const data, chunk_t const * const chunk, uint_fast32_t * const offset_old)
+{
+	uint64_t pos;
+
+	for(pos=chunk->hash&mask; table[pos]; pos=(pos+1)&mask)
+	{
+		chunk_t const * const c=&old_chunks[table[pos]-1];
+		if(c->hash==chunk->hash && c->len==chunk->len && !memcmp(&old[c->offset], &data[chunk->offset], c->len))
+		{
+			(*offset_old)=c->offset;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void add_run(baseline_t * const baseline, const uint_fast32_t start, const uint_fast32_t end, const uint_fast32_t start_old)
+{
+	baseline->runs=realloc(baseline->runs, (baseline->nb_runs+1)*sizeof(baseline_run_t));
+	if(baseline->runs==NULL)
+		err(1, "realloc for runs failed");
+	baseline->runs[baseline->nb_runs].start=start;
+	baseline->runs[baseline->nb_runs].end=end;
+	baseline->runs[baseline->nb_runs].start_old=start_old;
+	baseline->nb_runs++;
+}
+
+static void find_runs(baseline_t * const baseline, uint8_t const * const old, const size_t size_old, uint8_t const * const data, const size_t fsize)
+{
+	uint_fast32_t nb_chunks_old, nb_chunks, i;
+	uint64_t mask;
+
+	chunk_t * chunks_old=make_chunks(old, size_old, &nb_chunks_old);
+	chunk_t * chunks=make_chunks(data, fsize, &nb_chunks);
+	uint32_t * table=make_table(chunks_old, nb_chunks_old, &mask);
+
+	for(i=0; i<nb_chunks; i++)
+	{
+		chunk_t const * const c=&chunks[i];
+		baseline_run_t * const last=baseline->nb_runs?&baseline->runs[baseline->nb_runs-1]:NULL;
+		uint_fast32_t offset_old;
+
+		//a chunk that is in the old dump more than once should continue the run it belongs to
+		if(last && last->end==c->offset)
+		{
+			const uint_fast32_t end_old=last->start_old+(last->end-last->start);
+			if(end_old+c->len<=size_old && !memcmp(&old[end_old], &data[c->offset], c->len))
+			{
+				last->end+=c->len;
+				continue;
+			}
+		}
+
+		if(find_chunk(old, chunks_old, table, mask, data, c, &offset_old))
+			add_run(baseline, c->offset, c->offset+c->len, offset_old);
+	}
+
+	free(chunks_old);
+	free(chunks);
+	free(table);
+
+	//the chunks around a change may still be partly identical
+	for(i=0; i<baseline->nb_runs; i++)
+	{
+		baseline_run_t * const run=&baseline->runs[i];
+		const uint_fast32_t limit_start=i?baseline->runs[i-1].end:0;
+		const uint_fast32_t limit_end=(i+1<baseline->nb_runs)?baseline->runs[i+1].start:fsize;
+		uint_fast32_t end_old=run->start_old+(run->end-run->start);
+
+		while(run->start>limit_start && run->start_old>0 && data[run->start-1]==old[run->start_old-1])
+		{
+			run->start--;
+			run->start_old--;
+		}
+
+		while(run->end<limit_end && end_old<size_old && data[run->end]==old[end_old])
+		{
+			run->end++;
+			end_old++;
+		}
+	}
+}
+
+static bool get_offset(char const * const line, uint_fast32_t * const offset, char const ** const offset_start, char const ** const offset_end)
+{
+	char * end;
+
+	char const * p=strstr(line, "\"offset\":");
+	if(p==NULL)
+		return false;
+	p+=strlen("\"offset\":");
+	(*offset)=strtoul(p, &end, 10);
+	if(end==p)
+		return false;
+
+	(*offset_start)=p;
+	(*offset_end)=end;
+	return true;
+}
+
+//only the results of the filesystem search, everything else is not searched with --baseline
+static old_record_t * load_results(char const * const filename, uint_fast32_t * const nb_records)
+{
+	char * buffer=NULL;
+	size_t sz_buffer=0;
+	ssize_t len;
+	uint_fast32_t nb_allocated=NB_RECORDS_INITIAL;
+	char const * offset_start;
+	char const * offset_end;
+	uint_fast32_t offset;
+
+	FILE * f=fopen(filename, "r");
+	if(f==NULL)
+		err(1, "can't open \"%s\"", filename);
+
+	old_record_t * records=malloc(nb_allocated*sizeof(old_record_t));
+	if(records==NULL)
+		err(1, "malloc for results failed");
+	(*nb_records)=0;
+
+	while((len=getline(&buffer, &sz_buffer, f))!=-1)
+	{
+		if(len>0 && buffer[len-1]=='\n')
+			buffer[--len]='\0';
+
+		if(strncmp(buffer, "{\"type\":\"magic\"", 15))
+			continue;
+
+		if(!get_offset(buffer, &offset, &offset_start, &offset_end))
+			errx(1, "result without offset in \"%s\": %s", filename, buffer);
+
+		if((*nb_records) && offset<records[(*nb_records)-1].offset)
+			errx(1, "results in \"%s\" are not ordered by offset, this is not the output of a single scan", filename);
+
+		if((*nb_records)==nb_allocated)
+		{
+			nb_allocated*=2;
+			records=realloc(records, nb_allocated*sizeof(old_record_t));
+			if(records==NULL)
+				err(1, "realloc for results failed");
+		}
+
+		records[*nb_records].offset=offset;
+		records[*nb_records].line=strdup(buffer);
+		if(records[*nb_records].line==NULL)
+			err(1, "strdup failed");
+		(*nb_records)++;
+	}
+
+	free(buffer);
+	fclose(f);
+
+	return records;
+}
+
+static void add_record(baseline_t * const baseline, char const * const line, const uint_fast32_t offset, uint_fast32_t * const nb_allocated)
+{
+	char const * offset_start;
+	char const * offset_end;
+	uint_fast32_t offset_old;
+
+	if(baseline->nb_records==(*nb_allocated))
+	{
+		(*nb_allocated)=(*nb_allocated)?2*(*nb_allocated):NB_RECORDS_INITIAL;
+		baseline->records=realloc(baseline->records, (*nb_allocated)*sizeof(baseline_record_t));
+		if(baseline->records==NULL)
+			err(1, "realloc for results failed");
+	}
+
+	if(!get_offset(line, &offset_old, &offset_start, &offset_end))
+		errx(1, "result without offset: %s", line); //checked by load_results(), can't happen
+
+	char * new_line=malloc(strlen(line)+21);
+	if(new_line==NULL)
+		err(1, "malloc for result failed");
+	sprintf(new_line, "%.*s%lu%s", (int)(offset_start-line), line, offset, offset_end);
+
+	baseline->records[baseline->nb_records].offset=offset;
+	baseline->records[baseline->nb_records].line=new_line;
+	baseline->nb_records++;
+
+	if(strstr(line, "\"valid\":true") && !strstr(line, "\"verify\":\"rejected\""))
+		baseline->success=true;
+}
+
+void baseline_init(baseline_t * const baseline, char const * const filename_old, char const * const filename_results, uint8_t const * const data, const size_t fsize, const uint_fast32_t blocksize, const uint_fast32_t scan_start, const uint_fast32_t scan_end)
+{
+	size_t size_old;
+	uint_fast32_t nb_old_records, nb_allocated=0;
+	uint_fast32_t i, j;
+
+	memset(baseline, 0, sizeof(baseline_t));
+	baseline->blocksize=blocksize;
+
+	gear_init();
+
+	uint8_t * old=load_file(filename_old, &size_old);
+	find_runs(baseline, old, size_old, data, fsize);
+	free(old);
+
+	old_record_t * old_records=load_results(filename_results, &nb_old_records);
+
+	//runs don't overlap and are ordered, so the records come out ordered too
+	for(i=0; i<baseline->nb_runs && scan_start<scan_end; i++)
+	{
+		baseline_run_t const * const run=&baseline->runs[i];
+
+		if(run->end-run->start<blocksize)
+			continue;
+
+		//offsets of the new dump where the whole block is inside the run
+		const uint_fast32_t first=(run->start>scan_start)?run->start:scan_start;
+		const uint_fast32_t last=(run->end-blocksize<scan_end-1)?(run->end-blocksize):(scan_end-1);
+
+		if(first>last)
+			continue;
+
+		baseline->nb_offsets_unchanged+=last-first+1;
+
+		const uint_fast32_t first_old=first-run->start+run->start_old;
+		const uint_fast32_t last_old=last-run->start+run->start_old;
+
+		//the same old region may appear more than once in the new dump, don't rely on the previous position
+		uint_fast32_t lo=0, hi=nb_old_records;
+		while(lo<hi)
+		{
+			const uint_fast32_t mid=lo+(hi-lo)/2;
+			if(old_records[mid].offset<first_old)
+				lo=mid+1;
+			else
+				hi=mid;
+		}
+
+		for(j=lo; j<nb_old_records && old_records[j].offset<=last_old; j++)
+			add_record(baseline, old_records[j].line, old_records[j].offset-run->start_old+run->start, &nb_allocated);
+	}
+
+	for(i=0; i<nb_old_records; i++)
+		free(old_records[i].line);
+	free(old_records);
+}
+
+bool baseline_block_unchanged(baseline_t * const baseline, const uint_fast32_t startpos)
+{
+	while(baseline->ind_run<baseline->nb_runs && baseline->runs[baseline->ind_run].end<startpos+baseline->blocksize)
+		baseline->ind_run++;
+
+	if(baseline->ind_run==baseline->nb_runs)
+		return false;
+
+	return startpos>=baseline->runs[baseline->ind_run].start;
+}
+
+void baseline_write_results(baseline_t * const baseline, jsonl_t * const j, const uint_fast32_t upto)
+{
+	while(baseline->ind_record<baseline->nb_records && baseline->records[baseline->ind_record].offset<upto)
+	{
+		jsonl_write_line(j, baseline->records[baseline->ind_record].line);
+		baseline->ind_record++;
+	}
+}
+
+void baseline_free(baseline_t * const baseline)
+{
+	uint_fast32_t i;
+
+	for(i=0; i<baseline->nb_records; i++)
+		free(baseline->records[i].line);
+	free(baseline->records);
+	free(baseline->runs);
+}
@@ -0,0 +1,59 @@
+#ifndef __BASELINE_H__
+#define __BASELINE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "jsonl.h"
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+//a region of the new dump that is identical to a region of the old one
+typedef struct
+{
+	uint_fast32_t start;
+	uint_fast32_t end;
+	uint_fast32_t start_old;
+} baseline_run_t;
+
+//a result of the old dump moved to where its block is in the new one
+typedef struct
+{
+	uint_fast32_t offset;
+	char * line; //JSONL with the offset already changed, without newline
+} baseline_record_t;
+
+typedef struct
+{
+	uint_fast32_t blocksize;
+
+	baseline_run_t * runs; //ordered and not overlapping
+	uint_fast32_t nb_runs;
+	uint_fast32_t ind_run;
+
+	baseline_record_t * records; //ordered by offset
+	uint_fast32_t nb_records;
+	uint_fast32_t ind_record;
+
+	uint64_t nb_offsets_unchanged; //between scan_start and scan_end
+	bool success; //at least one of the records is a filesystem not rejected by verify
+} baseline_t;
+
+//compares the dump in data with filename_old and takes over the results in filename_results (JSONL output of a scan of filename_old) for the offsets between scan_start and scan_end that don't need to be scanned again
+void baseline_init(baseline_t * const baseline, char const * const filename_old, char const * const filename_results, uint8_t const * const data, const size_t fsize, const uint_fast32_t blocksize, const uint_fast32_t scan_start, const uint_fast32_t scan_end);
+//true if the block at startpos is identical to a block of the old dump, startpos must not decrease from one call to the next
+bool baseline_block_unchanged(baseline_t * const baseline, const uint_fast32_t startpos);
+//writes the results taken over for the offsets before upto
+void baseline_write_results(baseline_t * const baseline, jsonl_t * const j, const uint_fast32_t upto);
+void baseline_free(baseline_t * const baseline);
+
+#endif
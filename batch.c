@@ -0,0 +1,252 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <err.h>
+
+#include "batch.h"
+
+/*
+This file is part of fsfuzz.
+
+Batch mode (--files) for scanning many dumps. The workers are processes and not threads: user_decrypt_block() and most of fsfuzz keep their state in static variables, a fork()ed worker gets its own copy of everything for free. user_decrypt_init() is called once before the workers are started so they all inherit what it has set up.
+
+The biggest dumps are started first. Small ones at the end fill the gaps, so all workers finish at about the same time.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define BATCH_NB_JOBS_INITIAL 64
+
+typedef struct
+{
+	pid_t pid;
+	uint_fast32_t ind_job;
+	struct timespec start;
+} batch_worker_t;
+
+static void batch_add(batch_t * const batch, char const * const filename, uint_fast32_t * const nb_allocated)
+{
+	struct stat st;
+	
+	if(stat(filename, &st))
+		err(1, "can't stat \"%s\"", filename);
+	
+	if(!S_ISREG(st.st_mode))
+		return;
+	
+	if(batch->nb_jobs==(*nb_allocated))
+	{
+		(*nb_allocated)*=2;
+		batch->jobs=realloc(batch->jobs, (*nb_allocated)*sizeof(batch_job_t));
+		if(batch->jobs==NULL)
+			err(1, "realloc for batch jobs failed");
+	}
+	
+	batch_job_t * const job=&batch->jobs[batch->nb_jobs++];
+	job->filename=strdup(filename);
+	if(job->filename==NULL)
+		err(1, "strdup for batch job failed");
+	job->name=strrchr(job->filename, '/')?(strrchr(job->filename, '/')+1):job->filename;
+	job->size=st.st_size;
+}
+
+static int compare_jobs(void const * a, void const * b)
+{
+	batch_job_t const * const ja=a;
+	batch_job_t const * const jb=b;
+	
+	if(ja->size!=jb->size)
+		return (ja->size>jb->size)?-1:1;
+	
+	return strcmp(ja->filename, jb->filename);
+}
+
+void batch_load(batch_t * const batch, char const * const list)
+{
+	uint_fast32_t nb_allocated=BATCH_NB_JOBS_INITIAL;
+	uint_fast32_t i, j;
+	struct stat st;
+	
+	batch->nb_jobs=0;
+	batch->jobs=malloc(nb_allocated*sizeof(batch_job_t));
+	if(batch->jobs==NULL)
+		err(1, "malloc for batch jobs failed");
+	
+	if(stat(list, &st))
+		err(1, "can't stat \"%s\"", list);
+	
+	if(S_ISDIR(st.st_mode))
+	{
+		DIR * dir=opendir(list);
+		struct dirent * entry;
+		char * path=NULL;
+		
+		if(dir==NULL)
+			err(1, "can't open directory \"%s\"", list);
+		
+		while((entry=readdir(dir)))
+		{
+			if(entry->d_name[0]=='.')
+				continue;
+			if(asprintf(&path, "%s/%s", list, entry->d_name)<0)
+				err(1, "asprintf for batch job failed");
+			batch_add(batch, path, &nb_allocated);
+			free(path);
+		}
+		
+		closedir(dir);
+	}
+	else
+	{
+		FILE * inp=fopen(list, "r");
+		char * line=NULL;
+		size_t sz_line=0;
+		
+		if(inp==NULL)
+			err(1, "can't open \"%s\"", list);
+		
+		while(getline(&line, &sz_line, inp)!=-1)
+		{
+			line[strcspn(line, "\r\n")]='\0';
+			if(line[0]=='\0' || line[0]=='#') //empty lines and comments
+				continue;
+			batch_add(batch, line, &nb_allocated);
+		}
+		
+		free(line);
+		fclose(inp);
+	}
+	
+	if(batch->nb_jobs==0)
+		errx(1, "no files found in \"%s\"", list);
+	
+	//the result files are named after the dumps
+	for(i=0; i<batch->nb_jobs; i++)
+	{
+		for(j=0; j<i; j++)
+		{
+			if(!strcmp(batch->jobs[i].name, batch->jobs[j].name))
+				errx(1, "\"%s\" and \"%s\" have the same name, results would overwrite each other", batch->jobs[i].filename, batch->jobs[j].filename);
+		}
+	}
+	
+	qsort(batch->jobs, batch->nb_jobs, sizeof(batch_job_t), compare_jobs);
+}
+
+static double elapsed_s(struct timespec const * const start)
+{
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return (now.tv_sec-start->tv_sec)+(now.tv_nsec-start->tv_nsec)/1e9;
+}
+
+int_fast32_t batch_run(batch_t const * const batch, const uint_fast32_t nb_workers)
+{
+	batch_worker_t * workers=calloc(nb_workers, sizeof(batch_worker_t));
+	uint_fast32_t nb_running=0;
+	uint_fast32_t next_job=0;
+	uint_fast32_t nb_done=0, nb_found=0, nb_failed=0;
+	uint64_t nb_bytes=0;
+	struct timespec start;
+	uint_fast32_t i;
+	
+	if(workers==NULL)
+		err(1, "calloc for batch workers failed");
+	
+	for(i=0; i<batch->nb_jobs; i++)
+		nb_bytes+=batch->jobs[i].size;
+	
+	printf("scanning %lu files (%.1f MB) with %lu workers\n\n", batch->nb_jobs, nb_bytes/1e6, nb_workers);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	
+	while(next_job<batch->nb_jobs || nb_running)
+	{
+		if(next_job<batch->nb_jobs && nb_running<nb_workers)
+		{
+			for(i=0; workers[i].pid; i++); //free slot
+			
+			fflush(stdout); //else the worker would print what is still in the buffer a second time
+			
+			pid_t pid=fork();
+			if(pid<0)
+				err(1, "fork failed");
+			
+			if(pid==0)
+			{
+				int_fast32_t ind_job=next_job;
+				free(workers);
+				return ind_job;
+			}
+			
+			workers[i].pid=pid;
+			workers[i].ind_job=next_job++;
+			clock_gettime(CLOCK_MONOTONIC, &workers[i].start);
+			nb_running++;
+			continue;
+		}
+		
+		int status;
+		pid_t pid=wait(&status);
+		if(pid<0)
+			err(1, "wait failed");
+		
+		for(i=0; i<nb_workers && workers[i].pid!=pid; i++);
+		if(i==nb_workers)
+			continue; //not ours
+		
+		batch_job_t const * const job=&batch->jobs[workers[i].ind_job];
+		nb_done++;
+		printf("[%lu/%lu] %s: ", nb_done, batch->nb_jobs, job->filename);
+		if(WIFEXITED(status) && WEXITSTATUS(status)==0)
+		{
+			printf("found something");
+			nb_found++;
+		}
+		else if(WIFEXITED(status) && WEXITSTATUS(status)==BATCH_EXIT_NOTHING_FOUND)
+			printf("nothing found");
+		else if(WIFEXITED(status))
+		{
+			printf("FAILED with exit code %d", WEXITSTATUS(status));
+			nb_failed++;
+		}
+		else
+		{
+			printf("FAILED, killed by signal %d", WTERMSIG(status));
+			nb_failed++;
+		}
+		printf(" (%.1f s)\n", elapsed_s(&workers[i].start));
+		
+		workers[i].pid=0;
+		nb_running--;
+	}
+	
+	double seconds=elapsed_s(&start);
+	printf("\n%lu files scanned in %.1f s (%.2f MB/s): %lu with results, %lu failed\n", batch->nb_jobs, seconds, nb_bytes/1e6/seconds, nb_found, nb_failed);
+	
+	free(workers);
+	
+	return -1;
+}
+
+void batch_free(batch_t * const batch)
+{
+	uint_fast32_t i;
+	
+	for(i=0; i<batch->nb_jobs; i++)
+		free(batch->jobs[i].filename);
+	free(batch->jobs);
+}
@@ -0,0 +1,38 @@
+#ifndef __BATCH_H__
+#define __BATCH_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define BATCH_EXIT_NOTHING_FOUND 3 //exit code of a worker whose dump gave no result
+
+typedef struct
+{
+	char * filename;
+	char const * name; //filename without directories, used for the result files
+	uint64_t size;
+} batch_job_t;
+
+typedef struct
+{
+	batch_job_t * jobs; //biggest first
+	uint_fast32_t nb_jobs;
+} batch_t;
+
+//list is a text file with one filename per line or a directory
+void batch_load(batch_t * const batch, char const * const list);
+//Returns -1 in the parent once all jobs are done. In the worker (child process) it returns the index of the job to do, the worker must exit when it's done.
+int_fast32_t batch_run(batch_t const * const batch, const uint_fast32_t nb_workers);
+void batch_free(batch_t * const batch);
+
+#endif
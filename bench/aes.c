@@ -0,0 +1,185 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "aes.h"
+
+/*
+This file is part of fsfuzz.
+
+Plain AES-128 (FIPS-197) for the reference transforms of the benchmark. Not constant time and not particularly fast, don't use it for anything else.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+static const uint8_t sbox[256]={
+	0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+	0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+	0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+	0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+	0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+	0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+	0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+	0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+	0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+	0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+	0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+	0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+	0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+	0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+	0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+	0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+};
+
+static uint8_t inv_sbox[256];
+static uint8_t mul9[256], mul11[256], mul13[256], mul14[256]; //for InvMixColumns
+
+static uint8_t xtime(const uint8_t x)
+{
+	return (x<<1)^((x&0x80)?0x1b:0x00);
+}
+
+static uint8_t mul(uint8_t a, uint8_t b)
+{
+	uint8_t r=0;
+	
+	while(b)
+	{
+		if(b&1)
+			r^=a;
+		a=xtime(a);
+		b>>=1;
+	}
+	
+	return r;
+}
+
+void aes128_init(aes128_t * const aes, uint8_t const * const key)
+{
+	uint_fast16_t i;
+	uint8_t rcon=0x01;
+	
+	for(i=0; i<256; i++)
+	{
+		inv_sbox[sbox[i]]=i;
+		mul9[i]=mul(i, 9);
+		mul11[i]=mul(i, 11);
+		mul13[i]=mul(i, 13);
+		mul14[i]=mul(i, 14);
+	}
+	
+	memcpy(aes->round_key, key, AES_BLOCK_SIZE);
+	
+	for(i=AES_BLOCK_SIZE; i<sizeof(aes->round_key); i+=4)
+	{
+		uint8_t t[4];
+		
+		memcpy(t, &aes->round_key[i-4], 4);
+		if(i%AES_BLOCK_SIZE==0)
+		{
+			uint8_t tmp=t[0];
+			t[0]=sbox[t[1]]^rcon;
+			t[1]=sbox[t[2]];
+			t[2]=sbox[t[3]];
+			t[3]=sbox[tmp];
+			rcon=xtime(rcon);
+		}
+		
+		aes->round_key[i+0]=aes->round_key[i-16+0]^t[0];
+		aes->round_key[i+1]=aes->round_key[i-16+1]^t[1];
+		aes->round_key[i+2]=aes->round_key[i-16+2]^t[2];
+		aes->round_key[i+3]=aes->round_key[i-16+3]^t[3];
+	}
+}
+
+static void add_round_key(aes128_t const * const aes, uint8_t * const block, const uint_fast8_t round)
+{
+	uint_fast8_t i;
+	
+	for(i=0; i<AES_BLOCK_SIZE; i++)
+		block[i]^=aes->round_key[round*AES_BLOCK_SIZE+i];
+}
+
+//block is column-major like in FIPS-197: byte (row r, column c) is block[4*c+r]
+static void shift_rows(uint8_t * const block, const bool inverse)
+{
+	uint8_t tmp[AES_BLOCK_SIZE];
+	uint_fast8_t r, c;
+	
+	memcpy(tmp, block, AES_BLOCK_SIZE);
+	for(r=1; r<4; r++)
+	{
+		for(c=0; c<4; c++)
+		{
+			if(inverse)
+				block[4*((c+r)%4)+r]=tmp[4*c+r];
+			else
+				block[4*c+r]=tmp[4*((c+r)%4)+r];
+		}
+	}
+}
+
+void aes128_encrypt_block(aes128_t const * const aes, uint8_t * const block)
+{
+	uint_fast8_t round, i, c;
+	
+	add_round_key(aes, block, 0);
+	
+	for(round=1; round<=AES128_NB_ROUNDS; round++)
+	{
+		for(i=0; i<AES_BLOCK_SIZE; i++)
+			block[i]=sbox[block[i]];
+		
+		shift_rows(block, false);
+		
+		if(round!=AES128_NB_ROUNDS)
+		{
+			for(c=0; c<4; c++)
+			{
+				uint8_t * const col=&block[4*c];
+				uint8_t a0=col[0], a1=col[1], a2=col[2], a3=col[3];
+				uint8_t all=a0^a1^a2^a3;
+				col[0]^=all^xtime(a0^a1);
+				col[1]^=all^xtime(a1^a2);
+				col[2]^=all^xtime(a2^a3);
+				col[3]^=all^xtime(a3^a0);
+			}
+		}
+		
+		add_round_key(aes, block, round);
+	}
+}
+
+void aes128_decrypt_block(aes128_t const * const aes, uint8_t * const block)
+{
+	uint_fast8_t round, i, c;
+	
+	add_round_key(aes, block, AES128_NB_ROUNDS);
+	
+	for(round=AES128_NB_ROUNDS; round>0; round--)
+	{
+		shift_rows(block, true);
+		
+		for(i=0; i<AES_BLOCK_SIZE; i++)
+			block[i]=inv_sbox[block[i]];
+		
+		add_round_key(aes, block, round-1);
+		
+		if(round!=1)
+		{
+			for(c=0; c<4; c++)
+			{
+				uint8_t * const col=&block[4*c];
+				uint8_t a0=col[0], a1=col[1], a2=col[2], a3=col[3];
+				col[0]=mul14[a0]^mul11[a1]^mul13[a2]^mul9[a3];
+				col[1]=mul9[a0]^mul14[a1]^mul11[a2]^mul13[a3];
+				col[2]=mul13[a0]^mul9[a1]^mul14[a2]^mul11[a3];
+				col[3]=mul11[a0]^mul13[a1]^mul9[a2]^mul14[a3];
+			}
+		}
+	}
+}
@@ -0,0 +1,28 @@
+#ifndef __AES_H__
+#define __AES_H__
+
+#include <stdint.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define AES_BLOCK_SIZE 16
+#define AES128_NB_ROUNDS 10
+
+typedef struct
+{
+	uint8_t round_key[(AES128_NB_ROUNDS+1)*AES_BLOCK_SIZE];
+} aes128_t;
+
+void aes128_init(aes128_t * const aes, uint8_t const * const key);
+void aes128_encrypt_block(aes128_t const * const aes, uint8_t * const block);
+void aes128_decrypt_block(aes128_t const * const aes, uint8_t * const block);
+
+#endif
@@ -0,0 +1,71 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "../libfsfuzz.h"
+
+/*
+This file is part of fsfuzz.
+
+Scans a file with fsfuzz_scan_file() from libfsfuzz instead of the command line tool and prints the offset and magic_id of every valid hit (and its --verify status), one per line. run.sh compares this to the JSONL output of fsfuzz for the same image so the library doesn't silently drift away from the CLI. Also a minimal example of how to use the library.
+
+usage: libcheck $image $blocksize [verify]
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+void user_decrypt_init(const uint_fast32_t blocksize);
+void user_decrypt_block(uint8_t * const block, const uint_fast32_t blocksize);
+void user_decrypt_cleanup(void);
+
+static void decrypt(uint8_t * const block, const uint_fast32_t blocksize, void * const userdata)
+{
+	(void)userdata;
+	user_decrypt_block(block, blocksize);
+}
+
+static void print_hit(hit_t const * const hit, uint8_t const * const block, void * const userdata)
+{
+	(void)block;
+	bool const * const verify=userdata;
+
+	if(hit->type!=HIT_MAGIC)
+		return;
+
+	if(*verify)
+		printf("%lu %lu %s\n", hit->offset, hit->ind_magic, verify_status_names[hit->verify_status]);
+	else
+		printf("%lu %lu\n", hit->offset, hit->ind_magic);
+}
+
+int main(int argc, char ** argv)
+{
+	if(argc!=3 && !(argc==4 && !strcmp(argv[3], "verify")))
+		errx(1, "usage: libcheck $image $blocksize [verify]");
+
+	uint_fast32_t blocksize=strtoul(argv[2], NULL, 0);
+	bool verify=(argc==4);
+	fsfuzz_t ctx;
+
+	user_decrypt_init(blocksize);
+
+	fsfuzz_init(&ctx, blocksize);
+	ctx.decrypt=decrypt;
+	ctx.on_hit=print_hit;
+	ctx.hit_userdata=&verify;
+	ctx.verify=verify;
+
+	fsfuzz_scan_file(&ctx, argv[1]);
+
+	fsfuzz_free(&ctx);
+	user_decrypt_cleanup();
+
+	return 0;
+}
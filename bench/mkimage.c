@@ -0,0 +1,282 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "transforms.h"
+
+/*
+This file is part of fsfuzz.
+
+Generates a synthetic firmware dump for the benchmark: random data with a few "filesystems" (a real superblock followed by random data) at random offsets, each of them encrypted on its own with one of the reference transforms. The offsets are written to a second file so the results of fsfuzz can be checked.
+
+usage: mkimage $transform $size $seed $image $truthfile [$nb_per_family]
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define FS_SIZE 65536 //of each embedded filesystem
+#define NB_TRIES_MAX 10000
+
+typedef void (*make_fs_t)(uint8_t * const fs);
+
+typedef struct
+{
+	char const * name; //must be a word of the description in the magic-database, used to check hits
+	make_fs_t make;
+	uint_fast32_t blocksize_min; //end of the headers written by make, a smaller --blocksize doesn't see all of them
+} family_t;
+
+static uint64_t rng_state;
+
+static uint64_t rng(void)
+{
+	//xorshift64*
+	rng_state^=rng_state>>12;
+	rng_state^=rng_state<<25;
+	rng_state^=rng_state>>27;
+	return rng_state*0x2545F4914F6CDD1DULL;
+}
+
+static void put_le(uint8_t * const p, const uint64_t val, const uint_fast8_t nb_bytes)
+{
+	uint_fast8_t i;
+	for(i=0; i<nb_bytes; i++)
+		p[i]=val>>(8*i);
+}
+
+static void put_be(uint8_t * const p, const uint64_t val, const uint_fast8_t nb_bytes)
+{
+	uint_fast8_t i;
+	for(i=0; i<nb_bytes; i++)
+		p[nb_bytes-1-i]=val>>(8*i);
+}
+
+//like in verify.c, duplicated to keep the generator independent of fsfuzz
+static uint32_t crc32_le(uint32_t crc, uint8_t const * const data, const uint_fast32_t len)
+{
+	uint_fast32_t i;
+	uint_fast8_t j;
+	
+	for(i=0; i<len; i++)
+	{
+		crc^=data[i];
+		for(j=0; j<8; j++)
+			crc=(crc&1)?(0xEDB88320^(crc>>1)):(crc>>1);
+	}
+	
+	return crc;
+}
+
+static void make_squashfs(uint8_t * const fs)
+{
+	memset(fs, 0, 96);
+	memcpy(fs, "hsqs", 4);
+	put_le(&fs[4], 42, 4); //inodes
+	put_le(&fs[8], 1600000000, 4); //mkfs_time
+	put_le(&fs[12], 131072, 4); //block_size
+	put_le(&fs[16], 1, 4); //fragments
+	put_le(&fs[20], 4, 2); //xz
+	put_le(&fs[22], 17, 2); //block_log
+	put_le(&fs[26], 1, 2); //no_ids
+	put_le(&fs[28], 4, 2); //major
+	put_le(&fs[40], FS_SIZE, 8); //bytes_used
+	put_le(&fs[48], FS_SIZE-16, 8); //id_table_start
+	put_le(&fs[56], UINT64_MAX, 8); //no xattrs
+	put_le(&fs[64], 0x100, 8); //inode_table_start
+	put_le(&fs[72], 0x400, 8); //directory_table_start
+	put_le(&fs[80], 0x800, 8); //fragment_table_start
+	put_le(&fs[88], UINT64_MAX, 8); //no export table
+}
+
+static void make_ext(uint8_t * const fs)
+{
+	uint8_t * const sb=&fs[0x400];
+	
+	memset(fs, 0, 0x800);
+	put_le(&sb[0x00], 16, 4); //inodes
+	put_le(&sb[0x04], FS_SIZE/1024, 4); //blocks
+	put_le(&sb[0x14], 1, 4); //first data block
+	put_le(&sb[0x18], 0, 4); //1kB blocks
+	put_le(&sb[0x38], 0xEF53, 2);
+	put_le(&sb[0x3A], 1, 2); //clean
+	put_le(&sb[0x3C], 1, 2); //errors: continue
+	put_le(&sb[0x4C], 1, 4); //dynamic revision
+	put_le(&sb[0x68], rng(), 8); //UUID
+	put_le(&sb[0x70], rng(), 8);
+	memcpy(&sb[0x78], "bench", 5);
+}
+
+static void make_jffs2(uint8_t * const fs)
+{
+	uint_fast8_t i;
+	
+	for(i=0; i<4; i++)
+	{
+		uint8_t * const node=&fs[i*64];
+		put_le(&node[0], 0x1985, 2);
+		put_le(&node[2], 0xE001, 2); //dirent
+		put_le(&node[4], 64, 4);
+		put_le(&node[8], crc32_le(0, node, 8), 4);
+	}
+}
+
+static void make_ubi(uint8_t * const fs)
+{
+	memset(fs, 0, 64);
+	memcpy(fs, "UBI#", 4);
+	fs[4]=1; //version
+	put_be(&fs[8], 3, 8); //erase counter
+	put_be(&fs[16], 64, 4); //VID header offset
+	put_be(&fs[20], 2048, 4); //data offset
+	put_be(&fs[24], rng(), 4); //image sequence
+	put_be(&fs[60], crc32_le(0xFFFFFFFF, fs, 60), 4);
+	
+	//the magic-database checks the VID header the EC header points to
+	uint8_t * const vid=&fs[64];
+	memset(vid, 0, 64);
+	memcpy(vid, "UBI!", 4);
+	vid[4]=1; //version
+	vid[5]=1; //dynamic volume
+	put_be(&vid[40], rng()>>16, 8); //sequence number
+	put_be(&vid[60], crc32_le(0xFFFFFFFF, vid, 60), 4);
+}
+
+static void make_cramfs(uint8_t * const fs)
+{
+	memset(fs, 0, 64);
+	put_le(&fs[0], 0x28cd3d45, 4);
+	put_le(&fs[4], FS_SIZE, 4);
+	put_le(&fs[8], 3, 4); //version 2, sorted dirs
+	memcpy(&fs[16], "Compressed ROMFS", 16);
+	put_le(&fs[32], rng()|1, 4); //CRC, not checked
+	put_le(&fs[40], 16, 4); //blocks
+	put_le(&fs[44], 4, 4); //files
+	memcpy(&fs[48], "bench", 5);
+}
+
+static void make_iso(uint8_t * const fs)
+{
+	uint8_t * const pvd=&fs[0x8000];
+	
+	memset(&fs[0x8000-2048], 0, 2048+2048);
+	memcpy(pvd, "\x01" "CD001" "\x01\x00", 8);
+	memset(&pvd[8], ' ', 64);
+	memcpy(&pvd[8], "LINUX", 5);
+	memcpy(&pvd[40], "BENCH", 5);
+}
+
+static void make_romfs(uint8_t * const fs)
+{
+	memset(fs, 0, 32);
+	memcpy(fs, "-rom1fs-", 8);
+	put_be(&fs[8], FS_SIZE, 4);
+	memcpy(&fs[16], "bench", 5);
+}
+
+static void make_minix(uint8_t * const fs)
+{
+	uint8_t * const sb=&fs[0x400];
+	
+	memset(fs, 0, 0x420);
+	put_le(&sb[0x00], 32, 2); //inodes
+	put_le(&sb[0x10], 0x2468, 2); //V2
+	put_le(&sb[0x12], 1, 2); //clean
+	put_le(&sb[0x14], FS_SIZE/1024, 4); //zones
+}
+
+static const family_t families[]=
+{
+	{ "Squashfs", make_squashfs, 96 },
+	{ "EXT", make_ext, 0x800 },
+	{ "JFFS2", make_jffs2, 4*64 },
+	{ "UBI", make_ubi, 2*64 },
+	{ "CramFS", make_cramfs, 64 },
+	{ "ISO", make_iso, 0x8800 },
+	{ "romfs", make_romfs, 32 },
+	{ "Minix", make_minix, 0x420 }
+};
+
+#define NB_FAMILIES (sizeof(families)/sizeof(family_t))
+
+int main(int argc, char ** argv)
+{
+	if(argc!=6 && argc!=7)
+		errx(1, "usage: mkimage $transform $size $seed $image $truthfile [$nb_per_family]");
+	
+	transform_t transform=transform_from_name(argv[1]);
+	uint_fast32_t size=strtoul(argv[2], NULL, 0);
+	rng_state=strtoull(argv[3], NULL, 0)*2+1; //must not be 0
+	uint_fast32_t nb_per_family=(argc==7)?strtoul(argv[6], NULL, 0):1;
+	uint_fast32_t nb_fs=NB_FAMILIES*nb_per_family;
+	uint_fast32_t i, j;
+	
+	if(size<2*nb_fs*FS_SIZE)
+		errx(1, "size must be at least %lu bytes for %lu filesystems", 2*nb_fs*FS_SIZE, nb_fs);
+	
+	uint8_t * image=malloc(size);
+	uint8_t * fs=malloc(FS_SIZE);
+	uint_fast32_t * offsets=malloc(nb_fs*sizeof(uint_fast32_t));
+	if(image==NULL || fs==NULL || offsets==NULL)
+		err(1, "malloc failed");
+	
+	for(i=0; i<size; i++)
+		image[i]=rng();
+	
+	transform_init(transform);
+	
+	FILE * truth=fopen(argv[5], "w");
+	if(truth==NULL)
+		err(1, "can't open %s", argv[5]);
+	
+	for(i=0; i<nb_fs; i++)
+	{
+		uint_fast32_t tries;
+		
+		//random offset not overlapping any other filesystem
+		for(tries=0; tries<NB_TRIES_MAX; tries++)
+		{
+			offsets[i]=rng()%(size-FS_SIZE);
+			for(j=0; j<i; j++)
+			{
+				if(offsets[i]<offsets[j]+FS_SIZE && offsets[j]<offsets[i]+FS_SIZE)
+					break;
+			}
+			if(j==i)
+				break;
+		}
+		if(tries==NB_TRIES_MAX)
+			errx(1, "can't place filesystem %lu, use a bigger size", i);
+		
+		family_t const * const family=&families[i%NB_FAMILIES];
+		
+		for(j=0; j<FS_SIZE; j++)
+			fs[j]=rng();
+		family->make(fs);
+		transform_encrypt(transform, fs, FS_SIZE, 0);
+		memcpy(&image[offsets[i]], fs, FS_SIZE);
+		
+		fprintf(truth, "%lu %s %lu\n", offsets[i], family->name, family->blocksize_min);
+	}
+	
+	fclose(truth);
+	
+	FILE * f=fopen(argv[4], "wb");
+	if(f==NULL)
+		err(1, "can't open %s", argv[4]);
+	if(fwrite(image, size, 1, f)!=1)
+		err(1, "writing %s failed", argv[4]);
+	fclose(f);
+	
+	free(image);
+	free(fs);
+	free(offsets);
+	
+	return 0;
+}
@@ -0,0 +1,93 @@
+#! /bin/sh
+# This file is part of fsfuzz.
+# (c) 2023 by kittennbfive - https://github.com/kittennbfive - AGPLv3+ and NO WARRANTY!
+#
+# End-to-end benchmark: builds fsfuzz with each reference transform, generates a synthetic dump per transform and runs every scan mode on it.
+# Settings can be changed with environment variables, e.g. SIZE=0x400000 TRANSFORMS=xor ./run.sh
+
+set -e
+
+SIZE=${SIZE:-0x100000}
+SEED=${SEED:-1}
+NB_PER_FAMILY=${NB_PER_FAMILY:-1}
+BLOCKSIZE=${BLOCKSIZE:-2048}
+TRANSFORMS=${TRANSFORMS:-"xor aes-ctr aes-cbc"}
+MODES=${MODES:-"magic verify string strings-file regex entropy"}
+
+cd "$(dirname "$0")"
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# same sources as ../make, but with the user_funcs.c of the benchmark
+SOURCES=$(grep -o '[a-z_]*\.c' ../make | grep -v '^user_funcs\.c$' | sed 's,^,../,')
+
+gcc -Wall -Wextra -O3 -o "$WORK/mkimage" mkimage.c transforms.c aes.c
+
+printf 'bench\nCompressed ROMFS\nrom1fs\nhsqs\n' > "$WORK/strings.txt"
+
+mode_args()
+{
+	case $1 in
+		magic) echo "" ;;
+		verify) echo "--verify" ;;
+		string) echo "--string bench" ;;
+		strings-file) echo "--strings-file $WORK/strings.txt --encoding all" ;;
+		regex) echo "--regex Compressed.[A-Z]+" ;;
+		entropy) echo "--entropy-map $WORK/entropy.csv" ;;
+		*) echo "unknown mode $1" >&2; exit 1 ;;
+	esac
+}
+
+printf '%-8s %-13s %12s %9s %8s\n' transform mode offsets/s MB/s recall
+
+for T in $TRANSFORMS
+do
+	DEFINE=$(echo "TRANSFORM_$T" | tr 'a-z-' 'A-Z_')
+	gcc -Wall -Wextra -O3 -DBENCH_TRANSFORM=$DEFINE -I. -o "$WORK/fsfuzz_$T" $SOURCES user_funcs_bench.c transforms.c aes.c -lm -pthread
+	gcc -Wall -Wextra -O3 -DBENCH_TRANSFORM=$DEFINE -I. -o "$WORK/libcheck_$T" libcheck.c ../libfsfuzz.c ../magicdata.c ../verify.c user_funcs_bench.c transforms.c aes.c -lm -pthread
+	"$WORK/mkimage" $T $SIZE $SEED "$WORK/$T.img" "$WORK/$T.truth" $NB_PER_FAMILY
+	# filesystems whose headers don't fit in a block can't be found, they are left out of the recall
+	awk -v bs=$(($BLOCKSIZE)) '$3<=bs' "$WORK/$T.truth" > "$WORK/$T.findable"
+	NB_FS=$(wc -l < "$WORK/$T.findable")
+	
+	for M in $MODES
+	do
+		"$WORK/fsfuzz_$T" --file "$WORK/$T.img" --blocksize $BLOCKSIZE --stats --output jsonl "$WORK/out.jsonl" $(mode_args $M) > "$WORK/stdout.txt"
+		
+		# "offsets scanned: N in T s (R offsets/s)"
+		LINE=$(grep 'offsets scanned:' "$WORK/stdout.txt")
+		SECONDS_SCAN=$(echo "$LINE" | sed 's/.* in \([0-9.]*\) s.*/\1/')
+		OFFSETS_PER_S=$(echo "$LINE" | sed 's/.*(\([0-9]*\) offsets\/s).*/\1/')
+		MB_PER_S=$(awk -v size=$(stat -c %s "$WORK/$T.img") -v t=$SECONDS_SCAN 'BEGIN { printf "%.2f", size/t/1e6 }')
+		
+		# a filesystem is found if there is a valid hit at its offset
+		grep '"type":"magic"' "$WORK/out.jsonl" | grep '"valid":true' | sed 's/^{"type":"magic","offset":\([0-9]*\),.*/\1/' | sort -u > "$WORK/found.txt"
+		NB_FOUND=$(cut -d' ' -f1 "$WORK/$T.findable" | sort -u | comm -12 - "$WORK/found.txt" | wc -l)
+		
+		printf '%-8s %-13s %12s %9s %4s/%-3s\n' $T $M $OFFSETS_PER_S $MB_PER_S $NB_FOUND $NB_FS
+		
+		# the library must find the same as the CLI
+		case $M in
+			magic|verify)
+				"$WORK/libcheck_$T" "$WORK/$T.img" $BLOCKSIZE $([ $M = verify ] && echo verify) | sort > "$WORK/lib.txt"
+				sed -n 's/^{"type":"magic","offset":\([0-9]*\),"magic_id":\([0-9]*\),.*"valid":true\(,"verify":"\([a-z]*\)"\)\{0,1\}.*/\1 \2 \4/p' "$WORK/out.jsonl" | sed 's/ $//' | sort > "$WORK/cli.txt"
+				if ! cmp -s "$WORK/lib.txt" "$WORK/cli.txt"
+				then
+					echo "fsfuzz_scan_file() and fsfuzz disagree with $T $M:"
+					diff "$WORK/lib.txt" "$WORK/cli.txt" || true
+					exit 1
+				fi
+				;;
+		esac
+	done
+	
+	if [ $NB_FOUND -ne $NB_FS ]
+	then
+		echo "missed with $T:"
+		cut -d' ' -f1 "$WORK/$T.findable" | sort -u | comm -23 - "$WORK/found.txt" | while read O
+		do
+			grep "^$O " "$WORK/$T.findable"
+		done
+	fi
+	awk -v bs=$(($BLOCKSIZE)) -v T=$T '$3>bs { print "left out of the recall with " T ": " $2 " at " $1 " needs a blocksize of " $3 }' "$WORK/$T.truth"
+done
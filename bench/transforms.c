@@ -0,0 +1,137 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "transforms.h"
+#include "aes.h"
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+char const * const transform_names[NB_TRANSFORMS]={ "xor", "aes-ctr", "aes-cbc" };
+
+static const uint8_t key[AES_BLOCK_SIZE]={ 'f', 's', 'f', 'u', 'z', 'z', '-', 'b', 'e', 'n', 'c', 'h', '-', 'k', 'e', 'y' };
+
+static aes128_t aes;
+static uint8_t cbc_previous[AES_BLOCK_SIZE]; //last ciphertext block of the previous call
+
+transform_t transform_from_name(char const * const name)
+{
+	uint_fast8_t i;
+	
+	for(i=0; i<NB_TRANSFORMS; i++)
+	{
+		if(!strcmp(name, transform_names[i]))
+			return i;
+	}
+	
+	errx(1, "unknown transform \"%s\" (xor, aes-ctr or aes-cbc)", name);
+}
+
+void transform_init(const transform_t transform)
+{
+	if(transform!=TRANSFORM_XOR)
+		aes128_init(&aes, key);
+}
+
+static void ctr_xor(uint8_t * const data, const uint_fast32_t len, const uint64_t pos)
+{
+	uint8_t keystream[AES_BLOCK_SIZE];
+	uint64_t counter=UINT64_MAX;
+	uint_fast32_t i;
+	uint_fast8_t j;
+	
+	for(i=0; i<len; i++)
+	{
+		if((pos+i)/AES_BLOCK_SIZE!=counter)
+		{
+			counter=(pos+i)/AES_BLOCK_SIZE;
+			memset(keystream, 0, AES_BLOCK_SIZE);
+			for(j=0; j<8; j++)
+				keystream[AES_BLOCK_SIZE-1-j]=counter>>(8*j);
+			aes128_encrypt_block(&aes, keystream);
+		}
+		data[i]^=keystream[(pos+i)%AES_BLOCK_SIZE];
+	}
+}
+
+static void cbc_check(const uint64_t pos)
+{
+	if(pos%AES_BLOCK_SIZE)
+		errx(1, "AES-CBC needs to start at a multiple of %u bytes", AES_BLOCK_SIZE);
+	
+	if(pos==0)
+		memset(cbc_previous, 0, AES_BLOCK_SIZE); //IV
+}
+
+void transform_encrypt(const transform_t transform, uint8_t * const data, const uint_fast32_t len, const uint64_t pos)
+{
+	uint_fast32_t i;
+	uint_fast8_t j;
+	
+	switch(transform)
+	{
+		case TRANSFORM_XOR:
+			for(i=0; i<len; i++)
+				data[i]^=key[(pos+i)%AES_BLOCK_SIZE];
+			break;
+		
+		case TRANSFORM_AES_CTR:
+			ctr_xor(data, len, pos);
+			break;
+		
+		case TRANSFORM_AES_CBC:
+			cbc_check(pos);
+			for(i=0; i+AES_BLOCK_SIZE<=len; i+=AES_BLOCK_SIZE)
+			{
+				for(j=0; j<AES_BLOCK_SIZE; j++)
+					data[i+j]^=cbc_previous[j];
+				aes128_encrypt_block(&aes, &data[i]);
+				memcpy(cbc_previous, &data[i], AES_BLOCK_SIZE);
+			}
+			break;
+		
+		default:
+			errx(1, "transform_encrypt: invalid transform");
+	}
+}
+
+void transform_decrypt(const transform_t transform, uint8_t * const data, const uint_fast32_t len, const uint64_t pos)
+{
+	uint8_t ciphertext[AES_BLOCK_SIZE];
+	uint_fast32_t i;
+	uint_fast8_t j;
+	
+	switch(transform)
+	{
+		case TRANSFORM_XOR:
+		case TRANSFORM_AES_CTR:
+			transform_encrypt(transform, data, len, pos);
+			break;
+		
+		case TRANSFORM_AES_CBC:
+			cbc_check(pos);
+			for(i=0; i+AES_BLOCK_SIZE<=len; i+=AES_BLOCK_SIZE)
+			{
+				memcpy(ciphertext, &data[i], AES_BLOCK_SIZE);
+				aes128_decrypt_block(&aes, &data[i]);
+				for(j=0; j<AES_BLOCK_SIZE; j++)
+					data[i+j]^=cbc_previous[j];
+				memcpy(cbc_previous, ciphertext, AES_BLOCK_SIZE);
+			}
+			break;
+		
+		default:
+			errx(1, "transform_decrypt: invalid transform");
+	}
+}
@@ -0,0 +1,34 @@
+#ifndef __TRANSFORMS_H__
+#define __TRANSFORMS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+//reference "encryptions" for the benchmark, each filesystem is encrypted on its own starting at its first byte
+typedef enum
+{
+	TRANSFORM_XOR, //16 byte key repeated
+	TRANSFORM_AES_CTR, //AES-128, counter starts at 0 for each filesystem
+	TRANSFORM_AES_CBC, //AES-128, IV is 0 for each filesystem
+	NB_TRANSFORMS
+} transform_t;
+
+extern char const * const transform_names[NB_TRANSFORMS];
+
+transform_t transform_from_name(char const * const name);
+void transform_init(const transform_t transform);
+//data[0] is at position pos inside the filesystem, for AES-CBC pos must be a multiple of 16, a partial block at the end is left as is and calls must be made in order
+void transform_encrypt(const transform_t transform, uint8_t * const data, const uint_fast32_t len, const uint64_t pos);
+void transform_decrypt(const transform_t transform, uint8_t * const data, const uint_fast32_t len, const uint64_t pos);
+
+#endif
@@ -0,0 +1,62 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "transforms.h"
+
+/*
+This file is part of fsfuzz.
+
+user_funcs.c for the benchmark, compile with -DBENCH_TRANSFORM=TRANSFORM_XOR (or TRANSFORM_AES_CTR, TRANSFORM_AES_CBC).
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#ifndef BENCH_TRANSFORM
+#error "BENCH_TRANSFORM must be defined"
+#endif
+
+static uint8_t * ctr_pad=NULL; //with CTR every block starts at position 0, so the keystream is always the same
+
+void user_decrypt_init(const uint_fast32_t blocksize)
+{
+	transform_init(BENCH_TRANSFORM);
+	
+	if(BENCH_TRANSFORM==TRANSFORM_AES_CTR)
+	{
+		ctr_pad=calloc(blocksize, 1);
+		if(ctr_pad==NULL)
+			err(1, "calloc for CTR keystream failed");
+		transform_encrypt(BENCH_TRANSFORM, ctr_pad, blocksize, 0);
+	}
+}
+
+void user_decrypt_block(uint8_t * const block, const uint_fast32_t blocksize)
+{
+	uint_fast32_t i;
+	
+	if(BENCH_TRANSFORM==TRANSFORM_AES_CTR && ctr_pad)
+	{
+		for(i=0; i<blocksize; i++)
+			block[i]^=ctr_pad[i];
+	}
+	else
+		transform_decrypt(BENCH_TRANSFORM, block, blocksize, 0);
+}
+
+void user_decrypt_stream(uint8_t * const data, const uint_fast32_t len, const uint64_t pos)
+{
+	transform_decrypt(BENCH_TRANSFORM, data, len, pos);
+}
+
+void user_decrypt_cleanup(void)
+{
+	free(ctr_pad);
+}
@@ -0,0 +1,250 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <err.h>
+
+#include "cache.h"
+#include "hash.h"
+
+/*
+This file is part of fsfuzz.
+
+Result cache (--cache) for dumps that are scanned again and again with the same options, for example when a pipeline is run again. The key is a hash of everything the results depend on: the content of the dump, the executable (user_decrypt_block() with its key and the magic-database are compiled in) and the options. An entry is the output of the scan as printed, the JSONL output if there was one and whether something was found.
+
+While recording stdout goes through a pipe to a child process that writes it to the terminal (or wherever stdout was) and to the entry, so the output is still shown while the scan is running.
+
+The files of an entry are written to $name.tmp and then renamed, $dir/$key is written last so an entry is only used if it is complete.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define CACHE_HEADER "fsfuzz cache 1"
+#define SZ_CACHE_LINE_MAX 128
+#define SZ_COPY_BUFFER 65536
+
+char const * user_decrypt_identity(void) __attribute__((weak));
+
+static uint64_t get_executable_hash(void)
+{
+	static uint64_t hash=0;
+	static bool hash_valid=false;
+	
+	if(hash_valid)
+		return hash;
+	
+	FILE * f=fopen("/proc/self/exe", "rb");
+	if(f==NULL)
+		err(1, "can't open /proc/self/exe");
+	if(fseek(f, 0, SEEK_END))
+		err(1, "fseek to end of /proc/self/exe failed");
+	long size=ftell(f);
+	if(fseek(f, 0, SEEK_SET))
+		err(1, "fseek to beginning of /proc/self/exe failed");
+	uint8_t * exe=malloc(size);
+	if(exe==NULL)
+		err(1, "malloc for executable failed");
+	if(fread(exe, size, 1, f)!=1)
+		err(1, "fread for /proc/self/exe failed");
+	fclose(f);
+	
+	hash=xxh64(exe, size, 0);
+	hash_valid=true;
+	free(exe);
+	
+	return hash;
+}
+
+static char * cache_path(char const * const dir, const uint64_t key, char const * const suffix)
+{
+	char * path=malloc(strlen(dir)+1+16+strlen(suffix)+1);
+	if(path==NULL)
+		err(1, "malloc for cache filename failed");
+	sprintf(path, "%s/%016lx%s", dir, key, suffix);
+	return path;
+}
+
+void cache_init(cache_t * const cache, char const * const dir, uint8_t const * const data, const size_t fsize, const uint64_t options_hash)
+{
+	uint64_t key[5];
+	
+	memset(cache, 0, sizeof(cache_t));
+	cache->stdout_saved=-1;
+	
+	if(mkdir(dir, 0755) && errno!=EEXIST)
+		err(1, "can't create directory %s", dir);
+	
+	key[0]=xxh64(data, fsize, 0);
+	key[1]=fsize;
+	key[2]=get_executable_hash();
+	key[3]=user_decrypt_identity?xxh64(user_decrypt_identity(), strlen(user_decrypt_identity()), 0):0;
+	key[4]=options_hash;
+	
+	const uint64_t hash=xxh64(key, sizeof(key), 0);
+	
+	cache->entry=cache_path(dir, hash, "");
+	cache->filename_txt=cache_path(dir, hash, ".txt");
+	cache->filename_jsonl=cache_path(dir, hash, ".jsonl");
+	cache->filename_tmp=malloc(strlen(cache->filename_jsonl)+5);
+	if(cache->filename_tmp==NULL)
+		err(1, "malloc for cache filename failed");
+	cache->file_size=fsize;
+}
+
+static void copy_file(char const * const from, char const * const to)
+{
+	char buffer[SZ_COPY_BUFFER];
+	size_t nb;
+	
+	FILE * in=fopen(from, "rb");
+	if(in==NULL)
+		err(1, "can't open %s", from);
+	FILE * out=strcmp(to, "-")?fopen(to, "wb"):stdout;
+	if(out==NULL)
+		err(1, "can't open %s for writing", to);
+	
+	while((nb=fread(buffer, 1, sizeof(buffer), in))>0)
+	{
+		if(fwrite(buffer, 1, nb, out)!=nb)
+			err(1, "writing %s failed", to);
+	}
+	if(ferror(in))
+		err(1, "reading %s failed", from);
+	
+	fclose(in);
+	if(out!=stdout && fclose(out))
+		err(1, "writing %s failed", to);
+}
+
+bool cache_replay(cache_t const * const cache, char const * const outputfile, bool * const success)
+{
+	char line[SZ_CACHE_LINE_MAX];
+	uint64_t file_size;
+	int found, has_jsonl;
+	
+	FILE * f=fopen(cache->entry, "r");
+	if(f==NULL)
+		return false;
+	
+	if(fgets(line, sizeof(line), f)==NULL || strncmp(line, CACHE_HEADER, strlen(CACHE_HEADER)))
+		errx(1, "%s is not a cache entry of this version of fsfuzz", cache->entry);
+	if(fscanf(f, "file_size %lu\n", &file_size)!=1 || fscanf(f, "success %d\n", &found)!=1 || fscanf(f, "jsonl %d\n", &has_jsonl)!=1)
+		errx(1, "cache entry %s is damaged", cache->entry);
+	fclose(f);
+	
+	if(file_size!=cache->file_size || (outputfile && !has_jsonl))
+		return false; //different dump with the same key, very unlikely
+	
+	printf("results from cache %s\n\n", cache->entry);
+	copy_file(cache->filename_txt, "-");
+	if(outputfile)
+		copy_file(cache->filename_jsonl, outputfile);
+	
+	(*success)=found;
+	
+	return true;
+}
+
+void cache_record_start(cache_t * const cache)
+{
+	int fds[2];
+	
+	fflush(stdout); //else the tee would print what is still in the buffer a second time
+	
+	sprintf(cache->filename_tmp, "%s.tmp", cache->filename_txt);
+	FILE * f=fopen(cache->filename_tmp, "wb");
+	if(f==NULL)
+		err(1, "can't open %s for writing", cache->filename_tmp);
+	
+	if(pipe(fds))
+		err(1, "pipe for cache failed");
+	
+	cache->tee_pid=fork();
+	if(cache->tee_pid<0)
+		err(1, "fork failed");
+	
+	if(cache->tee_pid==0)
+	{
+		char buffer[SZ_COPY_BUFFER];
+		ssize_t nb;
+		
+		close(fds[1]);
+		while((nb=read(fds[0], buffer, sizeof(buffer)))>0)
+		{
+			if(write(STDOUT_FILENO, buffer, nb)!=nb || fwrite(buffer, 1, nb, f)!=(size_t)nb)
+				_exit(1);
+		}
+		_exit((nb<0 || fclose(f))?1:0); //not exit(), stdio buffers of the parent must not be written again
+	}
+	
+	fclose(f);
+	close(fds[0]);
+	cache->stdout_saved=dup(STDOUT_FILENO);
+	if(cache->stdout_saved<0 || dup2(fds[1], STDOUT_FILENO)<0)
+		err(1, "dup2 for cache failed");
+	close(fds[1]);
+}
+
+static void cache_store(char const * const from, char const * const to, char * const filename_tmp)
+{
+	sprintf(filename_tmp, "%s.tmp", to);
+	copy_file(from, filename_tmp);
+	if(rename(filename_tmp, to))
+		err(1, "can't rename %s to %s", filename_tmp, to);
+}
+
+void cache_record_finish(cache_t * const cache, char const * const outputfile, const bool success)
+{
+	int status;
+	
+	//the tee gets EOF once the pipe is no longer stdout
+	fflush(stdout);
+	if(dup2(cache->stdout_saved, STDOUT_FILENO)<0)
+		err(1, "dup2 for cache failed");
+	close(cache->stdout_saved);
+	cache->stdout_saved=-1;
+	
+	if(waitpid(cache->tee_pid, &status, 0)<0)
+		err(1, "waitpid failed");
+	
+	sprintf(cache->filename_tmp, "%s.tmp", cache->filename_txt);
+	if(!WIFEXITED(status) || WEXITSTATUS(status))
+	{
+		unlink(cache->filename_tmp);
+		printf("warning: recording the output for the cache failed, nothing stored\n");
+		return;
+	}
+	
+	if(rename(cache->filename_tmp, cache->filename_txt))
+		err(1, "can't rename %s to %s", cache->filename_tmp, cache->filename_txt);
+	
+	if(outputfile)
+		cache_store(outputfile, cache->filename_jsonl, cache->filename_tmp);
+	
+	sprintf(cache->filename_tmp, "%s.tmp", cache->entry);
+	FILE * f=fopen(cache->filename_tmp, "w");
+	if(f==NULL)
+		err(1, "can't open %s for writing", cache->filename_tmp);
+	fprintf(f, "%s\nfile_size %lu\nsuccess %d\njsonl %d\n", CACHE_HEADER, cache->file_size, success, outputfile!=NULL);
+	if(fclose(f))
+		err(1, "writing %s failed", cache->filename_tmp);
+	if(rename(cache->filename_tmp, cache->entry))
+		err(1, "can't rename %s to %s", cache->filename_tmp, cache->entry);
+}
+
+void cache_free(cache_t * const cache)
+{
+	free(cache->entry);
+	free(cache->filename_txt);
+	free(cache->filename_jsonl);
+	free(cache->filename_tmp);
+}
@@ -0,0 +1,40 @@
+#ifndef __CACHE_H__
+#define __CACHE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+typedef struct
+{
+	char * entry; //$dir/$key, the other files are $dir/$key.txt and $dir/$key.jsonl
+	char * filename_txt;
+	char * filename_jsonl;
+	char * filename_tmp; //.tmp is added for each of the above while writing
+	uint64_t file_size;
+	int stdout_saved; //while recording
+	pid_t tee_pid;
+} cache_t;
+
+//the key is made of the XXH64 of data, of the executable (decryption, key and magic-database are compiled in), of user_decrypt_identity() if provided and of the options
+void cache_init(cache_t * const cache, char const * const dir, uint8_t const * const data, const size_t fsize, const uint64_t options_hash);
+//If there is an entry for the key the stored output is printed, the stored JSONL output is copied to outputfile (NULL if none) and true is returned.
+bool cache_replay(cache_t const * const cache, char const * const outputfile, bool * const success);
+//everything printed from now on is also recorded
+void cache_record_start(cache_t * const cache);
+//stores what was recorded and the JSONL output in outputfile (NULL if none, must be closed) as the entry for the key
+void cache_record_finish(cache_t * const cache, char const * const outputfile, const bool success);
+void cache_free(cache_t * const cache);
+
+#endif
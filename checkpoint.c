@@ -0,0 +1,190 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "checkpoint.h"
+#include "hash.h"
+
+/*
+This file is part of fsfuzz.
+
+Checkpoints for long scans. The file says up to which offset the scan is done, how big the JSONL output was at that moment and which string/regex matches at or after that offset have already been reported, so a resumed scan neither misses nor repeats anything. Size and XXH64 of the input file and a hash of the options make sure it is resumed with the same file and command line.
+
+The file is written to $name.tmp and then renamed so an interruption while writing can't leave a broken checkpoint behind.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define CHECKPOINT_HEADER "fsfuzz checkpoint 2"
+#define SZ_CHECKPOINT_LINE_MAX 128
+
+void checkpoint_init(checkpoint_t * const ckpt, char const * const filename, uint8_t const * const data, const size_t fsize, const uint64_t options_hash)
+{
+	memset(ckpt, 0, sizeof(checkpoint_t));
+	
+	ckpt->filename=strdup(filename);
+	ckpt->filename_tmp=malloc(strlen(filename)+5);
+	if(ckpt->filename==NULL || ckpt->filename_tmp==NULL)
+		err(1, "malloc for checkpoint filename failed");
+	sprintf(ckpt->filename_tmp, "%s.tmp", filename);
+	
+	ckpt->file_size=fsize;
+	ckpt->file_hash=xxh64(data, fsize, 0);
+	ckpt->options_hash=options_hash;
+}
+
+void checkpoint_add_ring(checkpoint_t * const ckpt, uint_fast32_t * const reported, const size_t nb_entries)
+{
+	if(ckpt->nb_rings==CHECKPOINT_NB_RINGS_MAX)
+		errx(1, "checkpoint_add_ring: too many rings - this is a bug");
+	
+	ckpt->rings[ckpt->nb_rings].reported=reported;
+	ckpt->rings[ckpt->nb_rings].nb_entries=nb_entries;
+	ckpt->nb_rings++;
+}
+
+void checkpoint_add_slot_ring(checkpoint_t * const ckpt, reported_slot_t * const slots, const size_t nb_slots)
+{
+	if(ckpt->nb_slot_rings==CHECKPOINT_NB_RINGS_MAX)
+		errx(1, "checkpoint_add_slot_ring: too many rings - this is a bug");
+	
+	ckpt->slot_rings[ckpt->nb_slot_rings].slots=slots;
+	ckpt->slot_rings[ckpt->nb_slot_rings].nb_slots=nb_slots;
+	ckpt->nb_slot_rings++;
+}
+
+void reported_slot_add(reported_slot_t * const slot, const uint32_t id)
+{
+	if(slot->nb_ids==slot->nb_ids_allocated)
+	{
+		slot->nb_ids_allocated=slot->nb_ids_allocated?2*slot->nb_ids_allocated:2;
+		slot->ids=realloc(slot->ids, slot->nb_ids_allocated*sizeof(uint32_t));
+		if(slot->ids==NULL)
+			err(1, "realloc for reported patterns failed");
+	}
+	
+	slot->ids[slot->nb_ids++]=id;
+}
+
+void checkpoint_write(checkpoint_t const * const ckpt, const uint_fast32_t next_offset, const long output_pos, const bool success)
+{
+	uint_fast8_t i;
+	size_t j;
+	
+	FILE * f=fopen(ckpt->filename_tmp, "w");
+	if(f==NULL)
+		err(1, "can't open %s for writing", ckpt->filename_tmp);
+	
+	fprintf(f, "%s\n", CHECKPOINT_HEADER);
+	fprintf(f, "file_size %lu\n", ckpt->file_size);
+	fprintf(f, "file_hash 0x%016lx\n", ckpt->file_hash);
+	fprintf(f, "options_hash 0x%016lx\n", ckpt->options_hash);
+	fprintf(f, "next_offset %lu\n", next_offset);
+	fprintf(f, "output_pos %ld\n", output_pos);
+	fprintf(f, "success %u\n", success);
+	
+	//only matches at or after next_offset can be seen again, everything else in the rings is history
+	for(i=0; i<ckpt->nb_rings; i++)
+	{
+		for(j=0; j<ckpt->rings[i].nb_entries; j++)
+		{
+			if(ckpt->rings[i].reported[j]>next_offset)
+				fprintf(f, "reported %u %lu %lu\n", i, j, ckpt->rings[i].reported[j]);
+		}
+	}
+	
+	for(i=0; i<ckpt->nb_slot_rings; i++)
+	{
+		for(j=0; j<ckpt->slot_rings[i].nb_slots; j++)
+		{
+			reported_slot_t const * const slot=&ckpt->slot_rings[i].slots[j];
+			uint32_t k;
+			
+			if(slot->found_pos>next_offset)
+			{
+				for(k=0; k<slot->nb_ids; k++)
+					fprintf(f, "pattern %u %lu %lu %u\n", i, j, slot->found_pos, slot->ids[k]);
+			}
+		}
+	}
+	
+	if(fclose(f))
+		err(1, "writing checkpoint %s failed", ckpt->filename_tmp);
+	
+	if(rename(ckpt->filename_tmp, ckpt->filename))
+		err(1, "renaming %s to %s failed", ckpt->filename_tmp, ckpt->filename);
+}
+
+uint_fast32_t checkpoint_resume(checkpoint_t * const ckpt, long * const output_pos, bool * const success)
+{
+	char line[SZ_CHECKPOINT_LINE_MAX];
+	uint64_t file_size, file_hash, options_hash;
+	uint_fast32_t next_offset;
+	unsigned int success_u;
+	unsigned int ring;
+	size_t index;
+	uint_fast32_t value;
+	uint32_t id;
+	
+	FILE * f=fopen(ckpt->filename, "r");
+	if(f==NULL)
+		err(1, "can't open checkpoint %s", ckpt->filename);
+	
+	if(fgets(line, SZ_CHECKPOINT_LINE_MAX, f)==NULL || strncmp(line, CHECKPOINT_HEADER, strlen(CHECKPOINT_HEADER)))
+		errx(1, "%s is not a fsfuzz checkpoint", ckpt->filename);
+	
+	if(fscanf(f, " file_size %lu file_hash %lx options_hash %lx next_offset %lu output_pos %ld success %u", &file_size, &file_hash, &options_hash, &next_offset, output_pos, &success_u)!=6)
+		errx(1, "checkpoint %s is damaged", ckpt->filename);
+	
+	if(file_size!=ckpt->file_size || file_hash!=ckpt->file_hash)
+		errx(1, "checkpoint %s was made for a different input file", ckpt->filename);
+	
+	if(options_hash!=ckpt->options_hash)
+		errx(1, "checkpoint %s was made with different options, use exactly the same command line plus --resume", ckpt->filename);
+	
+	while(1)
+	{
+		if(fscanf(f, " reported %u %lu %lu", &ring, &index, &value)==3)
+		{
+			if(ring>=ckpt->nb_rings || index>=ckpt->rings[ring].nb_entries)
+				errx(1, "checkpoint %s is damaged", ckpt->filename);
+			ckpt->rings[ring].reported[index]=value;
+		}
+		else if(fscanf(f, "pattern %u %lu %lu %u", &ring, &index, &value, &id)==4)
+		{
+			if(ring>=ckpt->nb_slot_rings || index>=ckpt->slot_rings[ring].nb_slots)
+				errx(1, "checkpoint %s is damaged", ckpt->filename);
+			reported_slot_t * const slot=&ckpt->slot_rings[ring].slots[index];
+			if(slot->found_pos!=value)
+			{
+				slot->found_pos=value;
+				slot->nb_ids=0;
+			}
+			reported_slot_add(slot, id);
+		}
+		else
+			break;
+	}
+	
+	if(!feof(f))
+		errx(1, "checkpoint %s is damaged", ckpt->filename);
+	
+	fclose(f);
+	
+	(*success)=success_u;
+	
+	return next_offset;
+}
+
+void checkpoint_free(checkpoint_t * const ckpt)
+{
+	free(ckpt->filename);
+	free(ckpt->filename_tmp);
+}
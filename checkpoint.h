@@ -0,0 +1,69 @@
+#ifndef __CHECKPOINT_H__
+#define __CHECKPOINT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define CHECKPOINT_INTERVAL 60 //seconds between two checkpoints
+#define CHECKPOINT_CHECK_INTERVAL 4096 //offsets between two looks at the clock
+#define CHECKPOINT_NB_RINGS_MAX 4
+
+//"already reported" ring of a string/regex search, see match_already_reported() in fsfuzz.c
+typedef struct
+{
+	uint_fast32_t * reported;
+	size_t nb_entries;
+} checkpoint_ring_t;
+
+//one position of the "already reported" ring of a multi-pattern search, see pattern_already_reported() in fsfuzz.c
+typedef struct
+{
+	uint_fast32_t found_pos; //+1 so zeroed memory means "nothing reported"
+	uint32_t nb_ids;
+	uint32_t nb_ids_allocated;
+	uint32_t * ids; //patterns reported at found_pos
+} reported_slot_t;
+
+typedef struct
+{
+	reported_slot_t * slots;
+	size_t nb_slots;
+} checkpoint_slot_ring_t;
+
+typedef struct
+{
+	char * filename;
+	char * filename_tmp;
+	uint64_t file_size;
+	uint64_t file_hash;
+	uint64_t options_hash;
+	checkpoint_ring_t rings[CHECKPOINT_NB_RINGS_MAX];
+	uint_fast8_t nb_rings;
+	checkpoint_slot_ring_t slot_rings[CHECKPOINT_NB_RINGS_MAX];
+	uint_fast8_t nb_slot_rings;
+} checkpoint_t;
+
+void checkpoint_init(checkpoint_t * const ckpt, char const * const filename, uint8_t const * const data, const size_t fsize, const uint64_t options_hash);
+//rings must be added in the same order when writing and resuming
+void checkpoint_add_ring(checkpoint_t * const ckpt, uint_fast32_t * const reported, const size_t nb_entries);
+void checkpoint_add_slot_ring(checkpoint_t * const ckpt, reported_slot_t * const slots, const size_t nb_slots);
+//adds id to the patterns reported at found_pos in slot
+void reported_slot_add(reported_slot_t * const slot, const uint32_t id);
+//everything before next_offset is done, output_pos is the size of the JSONL output or -1
+void checkpoint_write(checkpoint_t const * const ckpt, const uint_fast32_t next_offset, const long output_pos, const bool success);
+//checks that the checkpoint belongs to this file and these options, restores the rings and returns the offset to continue with
+uint_fast32_t checkpoint_resume(checkpoint_t * const ckpt, long * const output_pos, bool * const success);
+void checkpoint_free(checkpoint_t * const ckpt);
+
+#endif
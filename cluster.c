@@ -0,0 +1,113 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "cluster.h"
+
+/*
+This file is part of fsfuzz.
+
+Collapses repeated hits (every node of a JFFS2, every erase block of an UBI, ...) into one region per filesystem. Hits must be added in ascending order of offset.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+void clusterer_init(clusterer_t * const cl, const uint_fast32_t nb_families, const uint_fast32_t max_gap, region_callback_t callback, void * const userdata)
+{
+	cl->nb_families=nb_families;
+	cl->max_gap=max_gap;
+	cl->callback=callback;
+	cl->userdata=userdata;
+	cl->next_expiry=UINT_FAST32_MAX;
+	
+	cl->open=calloc(nb_families, sizeof(region_t));
+	if(cl->open==NULL)
+		err(1, "calloc for clusterer failed");
+}
+
+static void clusterer_close(clusterer_t * const cl, region_t * const region)
+{
+	cl->callback(region, cl->userdata);
+	region->count=0;
+}
+
+void clusterer_add(clusterer_t * const cl, const uint_fast32_t family, const uint_fast32_t offset, const uint_fast32_t ind_magic, char const * const message)
+{
+	region_t * const region=&cl->open[family];
+	
+	if(region->count && offset-region->last>cl->max_gap)
+		clusterer_close(cl, region);
+	
+	if(region->count==0)
+	{
+		region->start=offset;
+		region->last=offset;
+		region->count=1;
+		region->stride=0;
+		region->max_spacing=0;
+		region->ind_magic=ind_magic;
+		strncpy(region->message, message, SZ_REGION_MESSAGE-1);
+		region->message[SZ_REGION_MESSAGE-1]='\0';
+	}
+	else
+	{
+		uint_fast32_t spacing=offset-region->last;
+		
+		if(region->count==1)
+			region->stride=spacing;
+		else if(spacing!=region->stride)
+			region->stride=0;
+		
+		if(spacing>region->max_spacing)
+			region->max_spacing=spacing;
+		
+		region->last=offset;
+		region->count++;
+	}
+	
+	if(offset+cl->max_gap<cl->next_expiry)
+		cl->next_expiry=offset+cl->max_gap;
+}
+
+void clusterer_expire(clusterer_t * const cl, const uint_fast32_t offset)
+{
+	uint_fast32_t i;
+	
+	if(offset<=cl->next_expiry)
+		return;
+	
+	cl->next_expiry=UINT_FAST32_MAX;
+	for(i=0; i<cl->nb_families; i++)
+	{
+		region_t * const region=&cl->open[i];
+		
+		if(!region->count)
+			continue;
+		
+		if(offset-region->last>cl->max_gap)
+			clusterer_close(cl, region);
+		else if(region->last+cl->max_gap<cl->next_expiry)
+			cl->next_expiry=region->last+cl->max_gap;
+	}
+}
+
+void clusterer_finish(clusterer_t * const cl)
+{
+	uint_fast32_t i;
+	
+	for(i=0; i<cl->nb_families; i++)
+	{
+		if(cl->open[i].count)
+			clusterer_close(cl, &cl->open[i]);
+	}
+	
+	free(cl->open);
+	cl->open=NULL;
+}
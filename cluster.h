@@ -0,0 +1,48 @@
+#ifndef __CLUSTER_H__
+#define __CLUSTER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define SZ_REGION_MESSAGE 1024
+
+//a run of hits of the same magic family, e.g. all the nodes of one JFFS2 filesystem
+typedef struct
+{
+	uint_fast32_t start; //offset of first hit
+	uint_fast32_t last; //offset of last hit
+	uint_fast32_t count;
+	uint_fast32_t stride; //distance between hits if it was always the same, else 0
+	uint_fast32_t max_spacing;
+	uint_fast32_t ind_magic; //of the first hit
+	char message[SZ_REGION_MESSAGE]; //of the first hit
+} region_t;
+
+typedef void (*region_callback_t)(region_t const * const region, void * const userdata);
+
+typedef struct
+{
+	uint_fast32_t nb_families;
+	uint_fast32_t max_gap; //hits further apart start a new region
+	region_t * open; //one per family, count==0 if none open
+	uint_fast32_t next_expiry; //no open region can expire before this offset
+	region_callback_t callback;
+	void * userdata;
+} clusterer_t;
+
+void clusterer_init(clusterer_t * const cl, const uint_fast32_t nb_families, const uint_fast32_t max_gap, region_callback_t callback, void * const userdata);
+void clusterer_add(clusterer_t * const cl, const uint_fast32_t family, const uint_fast32_t offset, const uint_fast32_t ind_magic, char const * const message);
+void clusterer_expire(clusterer_t * const cl, const uint_fast32_t offset); //closes every region that can't grow any more at offset
+void clusterer_finish(clusterer_t * const cl);
+
+#endif
@@ -0,0 +1,295 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <signal.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <err.h>
+
+#include "daemon.h"
+#include "batch.h"
+
+/*
+This file is part of fsfuzz.
+
+Daemon mode (--daemon) for services that call fsfuzz for many small dumps. The daemon calls user_decrypt_init() once and then waits for requests on a Unix socket. A request is a single line with the options for one scan, just like on the command line. Every request gets its own fork()ed worker, like --files, so it inherits the initialized decryptor and needs no locking. stdout and stderr of the worker are the connection, the client gets the output while the scan is running and the connection is closed when it's done.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define DAEMON_REQUEST_TIMEOUT 10 //seconds for the client to send its request
+
+typedef struct
+{
+	pid_t pid;
+	uint_fast32_t nb_request;
+	struct timespec start;
+} daemon_worker_t;
+
+static volatile sig_atomic_t stop=0;
+
+static void handle_stop(int sig)
+{
+	(void)sig;
+	stop=1;
+}
+
+//only there to interrupt accept()
+static void handle_child(int sig)
+{
+	(void)sig;
+}
+
+static double elapsed_s(struct timespec const * const start)
+{
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return (now.tv_sec-start->tv_sec)+(now.tv_nsec-start->tv_nsec)/1e9;
+}
+
+//words are separated by spaces or tabs, "..." keeps spaces inside a word and \ takes the next char as it is
+static int split_request(char * const line, char ** const args, const int nb_args_max)
+{
+	char * in=line;
+	char * out=line;
+	int nb_args=0;
+	
+	while(1)
+	{
+		while(*in==' ' || *in=='\t')
+			in++;
+		if(*in=='\0')
+			break;
+		
+		if(nb_args==nb_args_max)
+			errx(1, "too many words in request (max %d)", nb_args_max);
+		args[nb_args++]=out;
+		
+		bool quoted=false;
+		while(*in && (quoted || (*in!=' ' && *in!='\t')))
+		{
+			if(*in=='"')
+			{
+				quoted=!quoted;
+				in++;
+			}
+			else if(*in=='\\' && in[1])
+			{
+				*out++=in[1];
+				in+=2;
+			}
+			else
+				*out++=*in++;
+		}
+		if(quoted)
+			errx(1, "missing \" in request");
+		if(*in)
+			in++;
+		*out++='\0';
+	}
+	
+	return nb_args;
+}
+
+//in the worker, stdout and stderr are already the connection
+static void read_request(char * const request)
+{
+	uint_fast32_t len=0;
+	
+	while(1)
+	{
+		ssize_t nb=read(STDIN_FILENO, &request[len], DAEMON_REQUEST_MAX-len);
+		if(nb<0)
+			err(1, "reading request failed");
+		if(nb==0)
+			errx(1, "connection closed before end of request");
+		
+		char * const newline=memchr(&request[len], '\n', nb);
+		len+=nb;
+		if(newline)
+		{
+			*newline='\0';
+			break;
+		}
+		
+		if(len==DAEMON_REQUEST_MAX)
+			errx(1, "request too long (max %u bytes)", DAEMON_REQUEST_MAX);
+	}
+	
+	request[strcspn(request, "\r")]='\0';
+}
+
+static void worker_start(const int sock, const int conn, const uint_fast32_t nb_request, char * const argv0, int * const argc, char *** const argv)
+{
+	static char request[DAEMON_REQUEST_MAX];
+	static char * args[DAEMON_NB_ARGS_MAX+2];
+	struct timeval timeout={ .tv_sec=DAEMON_REQUEST_TIMEOUT, .tv_usec=0 };
+	
+	close(sock);
+	signal(SIGINT, SIG_DFL);
+	signal(SIGTERM, SIG_DFL);
+	signal(SIGCHLD, SIG_DFL);
+	
+	int log=dup(STDOUT_FILENO); //the daemon's output
+	if(log<0)
+		err(1, "dup failed");
+	
+	if(setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)))
+		err(1, "setsockopt failed");
+	
+	if(dup2(conn, STDIN_FILENO)<0 || dup2(conn, STDOUT_FILENO)<0 || dup2(conn, STDERR_FILENO)<0)
+		err(1, "dup2 for request #%lu failed", nb_request);
+	close(conn);
+	setvbuf(stdout, NULL, _IOLBF, 0); //results should reach the client while the scan is running
+	
+	read_request(request);
+	dprintf(log, "request #%lu: %s\n", nb_request, request);
+	close(log);
+	
+	args[0]=argv0;
+	(*argc)=1+split_request(request, &args[1], DAEMON_NB_ARGS_MAX);
+	args[*argc]=NULL;
+	(*argv)=args;
+}
+
+//block: wait until a worker has finished, else only collect those already done
+static void reap_workers(daemon_worker_t * const workers, const uint_fast32_t nb_workers, uint_fast32_t * const nb_running, const bool block)
+{
+	int status;
+	pid_t pid;
+	uint_fast32_t i;
+	
+	while((*nb_running) && (pid=waitpid(-1, &status, block?0:WNOHANG))!=0)
+	{
+		if(pid<0)
+		{
+			if(errno==EINTR)
+				return;
+			err(1, "waitpid failed");
+		}
+		
+		for(i=0; i<nb_workers && workers[i].pid!=pid; i++);
+		if(i==nb_workers)
+			continue; //not ours
+		
+		printf("request #%lu: ", workers[i].nb_request);
+		if(WIFEXITED(status) && WEXITSTATUS(status)==0)
+			printf("found something");
+		else if(WIFEXITED(status) && WEXITSTATUS(status)==BATCH_EXIT_NOTHING_FOUND)
+			printf("nothing found");
+		else if(WIFEXITED(status))
+			printf("FAILED with exit code %d", WEXITSTATUS(status));
+		else
+			printf("FAILED, killed by signal %d", WTERMSIG(status));
+		printf(" (%.1f s)\n", elapsed_s(&workers[i].start));
+		fflush(stdout);
+		
+		workers[i].pid=0;
+		(*nb_running)--;
+		
+		if(block)
+			return;
+	}
+}
+
+bool daemon_run(char const * const socketpath, const uint_fast32_t nb_workers, char * const argv0, int * const argc, char *** const argv)
+{
+	daemon_worker_t * workers=calloc(nb_workers, sizeof(daemon_worker_t));
+	struct sockaddr_un addr;
+	struct sigaction sa;
+	uint_fast32_t nb_running=0;
+	uint_fast32_t nb_requests=0;
+	uint_fast32_t i;
+	int sock;
+	
+	if(workers==NULL)
+		err(1, "calloc for daemon workers failed");
+	
+	if(strlen(socketpath)>=sizeof(addr.sun_path))
+		errx(1, "socket name \"%s\" is too long", socketpath);
+	
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family=AF_UNIX;
+	strcpy(addr.sun_path, socketpath);
+	
+	sock=socket(AF_UNIX, SOCK_STREAM, 0);
+	if(sock<0)
+		err(1, "can't create socket");
+	unlink(socketpath); //left over from a daemon that was killed
+	if(bind(sock, (struct sockaddr*)&addr, sizeof(addr)))
+		err(1, "can't bind socket to \"%s\"", socketpath);
+	if(listen(sock, DAEMON_BACKLOG))
+		err(1, "listen on \"%s\" failed", socketpath);
+	
+	//no SA_RESTART so accept() returns on Ctrl-C and when a worker is done
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler=handle_stop;
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+	sa.sa_handler=handle_child;
+	sigaction(SIGCHLD, &sa, NULL);
+	
+	printf("waiting for requests on \"%s\" with up to %lu workers, Ctrl-C to stop\n\n", socketpath, nb_workers);
+	fflush(stdout);
+	
+	while(!stop || nb_running)
+	{
+		reap_workers(workers, nb_workers, &nb_running, false);
+		
+		//further requests wait in the backlog of the socket
+		if(stop || nb_running==nb_workers)
+		{
+			reap_workers(workers, nb_workers, &nb_running, true);
+			continue;
+		}
+		
+		int conn=accept(sock, NULL, NULL);
+		if(conn<0)
+		{
+			if(errno==EINTR)
+				continue;
+			err(1, "accept failed");
+		}
+		
+		for(i=0; workers[i].pid; i++); //free slot
+		
+		nb_requests++;
+		pid_t pid=fork();
+		if(pid<0)
+			err(1, "fork failed");
+		
+		if(pid==0)
+		{
+			free(workers);
+			worker_start(sock, conn, nb_requests, argv0, argc, argv);
+			return true;
+		}
+		
+		close(conn);
+		workers[i].pid=pid;
+		workers[i].nb_request=nb_requests;
+		clock_gettime(CLOCK_MONOTONIC, &workers[i].start);
+		nb_running++;
+	}
+	
+	close(sock);
+	unlink(socketpath);
+	free(workers);
+	
+	printf("\n%lu requests done\n", nb_requests);
+	
+	return false;
+}
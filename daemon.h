@@ -0,0 +1,24 @@
+#ifndef __DAEMON_H__
+#define __DAEMON_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define DAEMON_REQUEST_MAX 4096 //bytes in the request line incl. newline
+#define DAEMON_NB_ARGS_MAX 256
+#define DAEMON_BACKLOG 64
+
+//Returns false in the daemon once it got SIGINT or SIGTERM and all requests are done. In the worker (child process) it returns true with stdout and stderr going to the client and argc/argv set to argv0 followed by the words of the request, the worker must exit when it's done.
+bool daemon_run(char const * const socketpath, const uint_fast32_t nb_workers, char * const argv0, int * const argc, char *** const argv);
+
+#endif
@@ -0,0 +1,160 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <err.h>
+
+#include "entropy.h"
+
+/*
+This file is part of fsfuzz.
+
+Entropy of decrypted data. Correctly decrypted filesystems have a much lower entropy than garbage, so this can find stuff that is not covered by the magic-database.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+void entropy_init(entropy_t * const e, const uint_fast32_t window)
+{
+	uint_fast32_t c;
+	
+	memset(e, 0, sizeof(entropy_t));
+	e->window=window;
+	
+	e->clogc=malloc((window+1)*sizeof(double));
+	if(e->clogc==NULL)
+		err(1, "malloc for entropy table failed");
+	
+	e->clogc[0]=0;
+	for(c=1; c<=window; c++)
+		e->clogc[c]=c*log2(c);
+}
+
+static void entropy_resync(entropy_t * const e)
+{
+	uint_fast16_t i;
+	
+	e->sum_clogc=0;
+	for(i=0; i<256; i++)
+		e->sum_clogc+=e->clogc[e->count[i]];
+	e->nb_updates=0;
+}
+
+void entropy_add(entropy_t * const e, const uint8_t byte)
+{
+	uint32_t c=e->count[byte]++;
+	e->sum_clogc+=e->clogc[c+1]-e->clogc[c];
+	e->nb_bytes++;
+	
+	if(++e->nb_updates==ENTROPY_RESYNC_INTERVAL)
+		entropy_resync(e);
+}
+
+void entropy_remove(entropy_t * const e, const uint8_t byte)
+{
+	uint32_t c=e->count[byte]--;
+	e->sum_clogc+=e->clogc[c-1]-e->clogc[c];
+	e->nb_bytes--;
+}
+
+void entropy_clear(entropy_t * const e)
+{
+	memset(e->count, 0, sizeof(e->count));
+	e->nb_bytes=0;
+	e->sum_clogc=0;
+	e->nb_updates=0;
+}
+
+double entropy_get(entropy_t const * const e)
+{
+	//H = -sum(c/n*log2(c/n)) = log2(n) - sum(c*log2(c))/n
+	if(e->nb_bytes==0)
+		return 0;
+	
+	return log2(e->nb_bytes)-e->sum_clogc/e->nb_bytes;
+}
+
+void entropy_free(entropy_t * const e)
+{
+	free(e->clogc);
+	e->clogc=NULL;
+}
+
+void entropymap_init(entropymap_t * const map, char const * const filename, const uint_fast32_t region_size, const uint_fast32_t window)
+{
+	memset(map, 0, sizeof(entropymap_t));
+	
+	map->outp=fopen(filename, "w");
+	if(!map->outp)
+		err(1, "can't open \"%s\" for writing", filename);
+	
+	map->region_size=region_size;
+	map->min=8;
+	map->average=-1;
+	
+	fprintf(map->outp, "#entropy in bits/byte of the first %lu decrypted bytes at each offset, per region of %lu offsets\n", window, region_size);
+	fprintf(map->outp, "region_start,region_end,min,min_offset,mean\n");
+}
+
+static void entropymap_write_region(entropymap_t * const map)
+{
+	if(!map->nb_values)
+		return;
+	
+	fprintf(map->outp, "0x%lx,0x%lx,%.3f,0x%lx,%.3f\n", map->region_start, map->region_start+map->nb_values, map->min, map->min_pos, map->sum/map->nb_values);
+	
+	map->nb_values=0;
+	map->sum=0;
+	map->min=8;
+}
+
+bool entropymap_update(entropymap_t * const map, const uint_fast32_t pos, const double entropy)
+{
+	bool drop=false;
+	
+	if(map->nb_values && pos/map->region_size!=map->region_start/map->region_size)
+		entropymap_write_region(map);
+	
+	if(!map->nb_values)
+		map->region_start=pos-(pos%map->region_size);
+	
+	map->nb_values++;
+	map->sum+=entropy;
+	if(entropy<map->min)
+	{
+		map->min=entropy;
+		map->min_pos=pos;
+	}
+	
+	if(map->average<0)
+		map->average=entropy;
+	
+	//report only the start of a drop, wait until the entropy comes back up halfway before reporting again
+	if(!map->in_drop && entropy<map->average-ENTROPY_DROP_THRESHOLD)
+	{
+		map->in_drop=true;
+		drop=true;
+	}
+	else if(map->in_drop && entropy>map->average-ENTROPY_DROP_THRESHOLD/2)
+		map->in_drop=false;
+	
+	//the average must not follow a long low-entropy area too quickly, else its end would not be noticed
+	if(!map->in_drop)
+		map->average+=(entropy-map->average)*ENTROPY_AVERAGE_WEIGHT;
+	
+	return drop;
+}
+
+void entropymap_finish(entropymap_t * const map)
+{
+	entropymap_write_region(map);
+	
+	if(fclose(map->outp))
+		err(1, "fclose for entropy map failed");
+}
@@ -0,0 +1,58 @@
+#ifndef __ENTROPY_H__
+#define __ENTROPY_H__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define ENTROPY_DROP_THRESHOLD 2.0 //bits/byte below the running average
+#define ENTROPY_AVERAGE_WEIGHT (1.0/4096) //for the running average
+#define ENTROPY_RESYNC_INTERVAL (1UL<<20) //sum_clogc is recomputed from the counts after this many updates so rounding errors can't pile up
+
+//byte histogram over a window with the Shannon entropy updated in O(1) per added or removed byte
+typedef struct
+{
+	uint_fast32_t window;
+	uint_fast32_t nb_bytes;
+	uint32_t count[256];
+	double sum_clogc; //sum of c*log2(c) over all counts
+	uint_fast32_t nb_updates;
+	double * clogc; //c*log2(c) for c=0...window
+} entropy_t;
+
+void entropy_init(entropy_t * const e, const uint_fast32_t window);
+void entropy_add(entropy_t * const e, const uint8_t byte);
+void entropy_remove(entropy_t * const e, const uint8_t byte);
+void entropy_clear(entropy_t * const e);
+double entropy_get(entropy_t const * const e); //bits per byte
+void entropy_free(entropy_t * const e);
+
+//per-region profile written as CSV plus detection of sharp drops
+typedef struct
+{
+	FILE * outp;
+	uint_fast32_t region_size;
+	uint_fast32_t region_start;
+	uint_fast32_t nb_values;
+	double sum;
+	double min;
+	uint_fast32_t min_pos;
+	double average; //running, over all offsets
+	bool in_drop;
+} entropymap_t;
+
+void entropymap_init(entropymap_t * const map, char const * const filename, const uint_fast32_t region_size, const uint_fast32_t window);
+bool entropymap_update(entropymap_t * const map, const uint_fast32_t pos, const double entropy); //returns true if a sharp drop starts at pos
+void entropymap_finish(entropymap_t * const map);
+
+#endif
@@ -0,0 +1,135 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <err.h>
+
+#include "extract.h"
+
+/*
+This file is part of fsfuzz.
+
+Writes the decrypted content of a hit to disk. The filesystem is decrypted chunk by chunk into a single buffer, so extracting a huge filesystem needs no more memory than a small one.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+void user_decrypt_block(uint8_t * const block, const uint_fast32_t blocksize);
+//optional, see user_funcs_EMPTY.c
+void user_decrypt_stream(uint8_t * const data, const uint_fast32_t len, const uint64_t pos) __attribute__((weak));
+
+void extractor_init(extractor_t * const ex, char const * const dir, view_t * const view, const uint_fast32_t blocksize, const bool position_independent)
+{
+	memset(ex, 0, sizeof(extractor_t));
+	
+	ex->dir=dir;
+	ex->view=view;
+	ex->blocksize=blocksize;
+	ex->position_independent=position_independent;
+	
+	ex->chunk_size=(EXTRACT_CHUNK_SIZE/blocksize)*blocksize;
+	if(ex->chunk_size==0)
+		ex->chunk_size=blocksize;
+	
+	ex->chunk=malloc(ex->chunk_size);
+	if(ex->chunk==NULL)
+		err(1, "malloc for extraction buffer failed");
+	
+	if(mkdir(dir, 0755) && errno!=EEXIST)
+		err(1, "can't create directory %s", dir);
+	
+	if(!user_decrypt_stream && !position_independent)
+		printf("warning: no user_decrypt_stream() provided, --extract will decrypt each %lu bytes on their own with user_decrypt_block()\n\n", blocksize);
+}
+
+//"Squashfs filesystem, ..." -> "squashfs", "Linux EXT filesystem, ..." -> "ext"
+static void make_name(char const * const message, char * const name, const size_t sz_name)
+{
+	char const * start=message;
+	char const * end=strstr(message, " filesystem");
+	size_t i;
+	
+	if(end)
+	{
+		start=end;
+		while(start>message && start[-1]!=' ')
+			start--;
+	}
+	else
+		end=message+strcspn(message, " ,");
+	
+	for(i=0; start+i<end && i<sz_name-1; i++)
+		name[i]=isalnum((unsigned char)start[i])?tolower((unsigned char)start[i]):'_';
+	name[i]='\0';
+}
+
+void extract_region(extractor_t * const ex, const uint_fast32_t offset, uint64_t size, const bool verified, char const * const message)
+{
+	char name[32];
+	char path[SZ_EXTRACT_PATH_MAX];
+	uint64_t pos;
+	FILE * f;
+	
+	if(ex->last_offset==offset+1)
+		return;
+	ex->last_offset=offset+1;
+	
+	const size_t raw_offset=view_raw_offset(ex->view, offset); //what the user sees in the results
+	
+	if(size>ex->view->size-offset) //offset+size could wrap around
+	{
+		if(!verified)
+		{
+			printf("warning: unverified filesystem at 0x%lx claims %lu bytes but the file ends after %lu, not extracted\n", raw_offset, size, ex->view->size-offset);
+			return;
+		}
+		printf("warning: filesystem at 0x%lx claims %lu bytes but the file ends after %lu, extracting truncated\n", raw_offset, size, ex->view->size-offset);
+		size=ex->view->size-offset;
+	}
+	
+	make_name(message, name, sizeof(name));
+	snprintf(path, SZ_EXTRACT_PATH_MAX, "%s/0x%08lx_%s.img", ex->dir, raw_offset, name);
+	
+	f=fopen(path, "wb");
+	if(f==NULL)
+		err(1, "can't open %s for writing", path);
+	
+	for(pos=0; pos<size; pos+=ex->chunk_size)
+	{
+		uint_fast32_t len=(size-pos<ex->chunk_size)?(size-pos):ex->chunk_size;
+		uint_fast32_t i;
+		
+		view_read(ex->view, ex->chunk, offset+pos, len);
+		
+		if(user_decrypt_stream)
+			user_decrypt_stream(ex->chunk, len, pos);
+		else if(ex->position_independent)
+			user_decrypt_block(ex->chunk, len);
+		else
+		{
+			for(i=0; i<len; i+=ex->blocksize)
+				user_decrypt_block(ex->chunk+i, (len-i<ex->blocksize)?(len-i):ex->blocksize);
+		}
+		
+		if(fwrite(ex->chunk, len, 1, f)!=1)
+			err(1, "writing to %s failed", path);
+	}
+	
+	fclose(f);
+	
+	printf("extracted %lu bytes to %s\n", size, path);
+}
+
+void extractor_free(extractor_t * const ex)
+{
+	free(ex->chunk);
+	memset(ex, 0, sizeof(extractor_t));
+}
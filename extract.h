@@ -0,0 +1,39 @@
+#ifndef __EXTRACT_H__
+#define __EXTRACT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "view.h"
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define EXTRACT_CHUNK_SIZE (1<<20)
+#define SZ_EXTRACT_PATH_MAX 1024
+
+typedef struct
+{
+	char const * dir;
+	view_t * view; //of the entire (encrypted) input file
+	uint_fast32_t blocksize;
+	bool position_independent;
+	uint8_t * chunk; //the only buffer, memory use doesn't depend on the size of the extracted filesystems
+	uint_fast32_t chunk_size; //multiple of blocksize
+	uint_fast32_t last_offset; //+1, several magic entries may match the same filesystem
+} extractor_t;
+
+void extractor_init(extractor_t * const ex, char const * const dir, view_t * const view, const uint_fast32_t blocksize, const bool position_independent);
+//decrypts size bytes of the view starting at offset and writes them to dir, message is the description of the hit and used to name the file
+//a verified filesystem that goes past the end of the dump is extracted truncated, an unverified one is skipped as its size is probably garbage
+void extract_region(extractor_t * const ex, const uint_fast32_t offset, uint64_t size, const bool verified, char const * const message);
+void extractor_free(extractor_t * const ex);
+
+#endif
@@ -4,11 +4,36 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <ctype.h>
+#include <math.h>
 #include <time.h>
+#include <signal.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
 #include <getopt.h>
 #include <err.h>
 
 #include "magicdata.h"
+#include "libfsfuzz.h"
+#include "ahocorasick.h"
+#include "regexdfa.h"
+#include "entropy.h"
+#include "cluster.h"
+#include "verify.h"
+#include "extract.h"
+#include "jsonl.h"
+#include "invalidsummary.h"
+#include "stats.h"
+#include "hash.h"
+#include "checkpoint.h"
+#include "merge.h"
+#include "scanorder.h"
+#include "batch.h"
+#include "daemon.h"
+#include "cache.h"
+#include "baseline.h"
+#include "view.h"
 
 /*
 fsfuzz - a tool to find individually obfuscated or encrypted filesystems in firmware dumps
@@ -28,18 +53,35 @@ except file "filesystems" everything is licenced under AGPLv3+ and provided WITH
 Please read the fine manual.
 */
 
-#define SZ_DATE_STR 30 //for test_convert_date(), man-page says >=26 -> should be fine
-#define SZ_FILENAME_MAX 50
+#define SZ_FILENAME_MAX 1024
 #define SZ_SEARCHSTRING_MAX 50
 #define NB_CHARS_BEFORE_STRMATCH 10
 #define NB_CHARS_AFTER_STRMATCH 10
+#define SZ_STRINGSFILE_LINE_MAX 1024
+#define NB_REGEX_MAX 16
+#define SZ_REGEXMATCH_PRINT_MAX 64
+#define GOLDEN_BLOCKSIZE 65536 //every test in the magic-database must be reachable
+#define GOLDEN_SEED 0x5eed
+#define MICROBENCH_NB_OFFSETS 20000
+#define MICROBENCH_NB_BLOCKS 256
+#define SAMPLE_CLOCK_INTERVAL 1024 //offsets between two looks at the clock for --time-budget
+#define NB_REPORTED_SET_INITIAL 1024
 
-typedef enum
+typedef struct
 {
-	TEST_INVALID,
-	TEST_SUCCESS,
-	TEST_FAILURE
-} testresult_t;
+	void const * ring; //identifies the search
+	uint32_t id; //pattern inside the search
+	uint_fast32_t found_pos;
+	view_t const * view; //the same match in another view is another match
+} reported_entry_t;
+
+//all matches reported so far, only used with --aligned-first, --sample and several views
+typedef struct
+{
+	uint_fast32_t nb_entries;
+	uint_fast32_t nb_entries_allocated; //power of 2
+	reported_entry_t * entries; //open addressing, ring==NULL means empty
+} reported_set_t;
 
 
 //You need to provide these, see user_funcs.c
@@ -47,545 +89,853 @@ void user_decrypt_init(const uint_fast32_t blocksize);
 void user_decrypt_block(uint8_t * const block, const uint_fast32_t blocksize);
 void user_decrypt_cleanup(void);
 
+static jsonl_t * output_jsonl=NULL; //--output jsonl, results go there instead of stdout
+static stats_t * scan_stats=NULL; //--stats
+static volatile sig_atomic_t interrupted=0; //Ctrl-C or SIGTERM with --checkpoint
+static uint_fast32_t decrypt_blocksize=0; //user_decrypt_init() was called for this blocksize, --files and --daemon do it before the workers are started
+static bool daemon_worker=false; //handling a request of --daemon
+static reported_set_t * reported_set=NULL; //--aligned-first and --sample (offsets are not visited in order) or several views, the rings in match_already_reported() are not enough
+static view_t const * input_view=NULL; //the scan sees offsets of the view, results show offsets of the file
 
-static uint64_t helper_get_value_unsigned(uint8_t const * const data, const uint_fast8_t nb_bytes, const endian_t endian)
+static uint_fast32_t raw_offset(const uint_fast32_t offset)
 {
-	uint64_t ret=0;
-	uint_fast8_t i;
+	return input_view?view_raw_offset(input_view, offset):offset;
+}
+
+//" [swap16]" after the offset of results not from the file as it is
+static char const * view_label(void)
+{
+	static char label[SZ_VIEW_NAME+3];
 	
-	if(endian==ENDIAN_LE)
-	{
-		for(i=0; i<nb_bytes; i++)
-			ret|=((uint64_t)data[i])<<(8*i);
-	}
-	else if(endian==ENDIAN_BE)
-	{
-		for(i=0; i<nb_bytes; i++)
-			ret|=((uint64_t)data[i])<<(8*(nb_bytes-i-1));		
-	}
-	else if(endian==ENDIAN_UNDEF && nb_bytes==1)
-		ret=(uint64_t)data[0];
-	else
-		errx(1, "helper_get_value_unsigned: undef endian for >1 byte requested");
+	if(input_view==NULL || input_view->name[0]=='\0')
+		return "";
 	
-	return ret;
-}	
+	sprintf(label, " [%s]", input_view->name);
+	return label;
+}
+
 
-static uint64_t get_value_unsigned(uint8_t const * const data, const datatype_t type, const endian_t endian)
+//entries whose first message starts with the same word (JFFS2, UBI, Squashfs, ...) belong to the same family and are clustered together
+static uint_fast32_t get_magic_family(const uint_fast32_t ind_magic)
 {
-	uint64_t ret=0;
+	static uint_fast32_t family[NB_ENTRIES_MAGIC];
+	static bool family_initialized=false;
+	uint_fast32_t i, j;
 	
-	switch(type)
+	if(!family_initialized)
 	{
-		case DATA_STRING:
-		case DATA_INT8:
-		case DATA_INT16:
-		case DATA_INT32:
-		case DATA_INT64:
-			errx(1, "get_value_unsigned: requested signed or string");
-			break;
-		
-		case DATA_DATE:
-		case DATA_UDATE:
-			errx(1, "get_value_unsigned: DATA_[U]DATE unimpl, call helper directly");
-			break;
-		
-		case DATA_UINT8:
-			ret=helper_get_value_unsigned(data, 1, endian);
-			break;
-		
-		case DATA_UINT16:
-			ret=helper_get_value_unsigned(data, 2, endian);
-			break;
-		
-		case DATA_UINT32:
-			ret=helper_get_value_unsigned(data, 4, endian);
-			break;
-		
-		case DATA_UINT64:
-			ret=helper_get_value_unsigned(data, 8, endian);
-			break;
+		for(i=0; i<NB_ENTRIES_MAGIC; i++)
+		{
+			char const * const msg_i=magic[i].tests[0].message;
+			size_t len_i=strcspn(msg_i, " ,");
+			
+			family[i]=i;
+			for(j=0; j<i; j++)
+			{
+				char const * const msg_j=magic[j].tests[0].message;
+				if(strcspn(msg_j, " ,")==len_i && !strncmp(msg_i, msg_j, len_i))
+				{
+					family[i]=family[j];
+					break;
+				}
+			}
+		}
+		family_initialized=true;
 	}
 	
-	return ret;
+	return family[ind_magic];
 }
 
-static int64_t helper_get_value_signed(uint8_t const * const data, const uint_fast8_t nb_bytes, const endian_t endian)
+static void print_region(region_t const * const region, void * const userdata)
 {
-	uint64_t u64=0;
-	int64_t ret;
-	uint_fast8_t i;
+	(void)userdata;
+	const uint_fast32_t start=region->start; //hits are clustered by their offset in the file
+	const uint_fast32_t last=region->last;
 	
-	if(endian==ENDIAN_LE)
+	if(output_jsonl) //the hits themselves are already written
 	{
-		for(i=0; i<nb_bytes; i++)
-			u64|=((uint64_t)data[i])<<(8*i);
+		char const * const name=magic[region->ind_magic].tests[0].message;
+		if(region->count>1)
+			jsonl_write_region(output_jsonl, start, last, region->count, region->stride, region->max_spacing, name, strcspn(name, " ,"));
+		return;
 	}
-	else if(endian==ENDIAN_BE)
+	
+	if(region->count==1)
+		printf("0x%lx (%lu)%s:%s\n", start, start, view_label(), region->message);
+	else if(region->stride)
+		printf("0x%lx (%lu)%s: region of %lu hits up to 0x%lx (%lu), stride 0x%lx:%s\n", start, start, view_label(), region->count, last, last, region->stride, region->message);
+	else
+		printf("0x%lx (%lu)%s: region of %lu hits up to 0x%lx (%lu), irregular spacing up to 0x%lx:%s\n", start, start, view_label(), region->count, last, last, region->max_spacing, region->message);
+}
+
+static void print_stringmatch(uint8_t const * const data, const uint_fast32_t blocksize, const uint_fast32_t match_index, const size_t len, const uint_fast32_t found_pos, char const * const label, char const * const match)
+{
+	if(output_jsonl)
 	{
-		for(i=0; i<nb_bytes; i++)
-			u64|=((uint64_t)data[i])<<(8*(nb_bytes-i-1));		
+		jsonl_write_match(output_jsonl, raw_offset(found_pos), label, match);
+		return;
 	}
-	else if(endian==ENDIAN_UNDEF && nb_bytes==1)
-		ret=(int64_t)data[0];
-	else
-		errx(1, "helper_get_value_signed: undef endian for >1 byte requested");
 	
-	if(u64&(1<<(8*nb_bytes-1)))
-		ret=-((u64-1)^((1ULL<<(8*nb_bytes))-1));
-	else
-		ret=u64;
+	char before[NB_CHARS_BEFORE_STRMATCH+1];
+	size_t nb_chars_to_copy=NB_CHARS_BEFORE_STRMATCH;
+	if(match_index<NB_CHARS_BEFORE_STRMATCH)
+		nb_chars_to_copy=match_index;
+	memcpy(before, data+match_index-nb_chars_to_copy, nb_chars_to_copy);
+	before[nb_chars_to_copy]='\0';
+	fsfuzz_mask_unprintable(before, nb_chars_to_copy);
 	
-	return ret;
-}	
+	char after[NB_CHARS_AFTER_STRMATCH+1];
+	nb_chars_to_copy=NB_CHARS_AFTER_STRMATCH;
+	if(match_index+len+NB_CHARS_AFTER_STRMATCH>blocksize)
+		nb_chars_to_copy=blocksize-(match_index+len);
+	memcpy(after, data+match_index+len, nb_chars_to_copy);
+	after[nb_chars_to_copy]='\0';
+	fsfuzz_mask_unprintable(after, nb_chars_to_copy);
+	
+	printf("0x%lx (%lu)%s: %s: %s%s%s\n", raw_offset(found_pos), raw_offset(found_pos), view_label(), label, before, match, after);
+}
 
-static int64_t get_value_signed(uint8_t const * const data, const datatype_t type, const endian_t endian)
+static uint_fast32_t reported_set_slot(reported_set_t const * const set, void const * const ring, const uint32_t id, const uint_fast32_t found_pos, view_t const * const view)
 {
-	int64_t ret=0;
+	uint_fast32_t slot=(((uintptr_t)ring>>3)^((uintptr_t)view>>3)^(id*0x85EBCA6BUL)^(found_pos*0x9E3779B1UL))&(set->nb_entries_allocated-1);
 	
-	switch(type)
-	{
-		case DATA_STRING:
-		case DATA_UINT8:
-		case DATA_UINT16:
-		case DATA_UINT32:
-		case DATA_UINT64:
-			errx(1, "get_value_signed: requested unsigned or string");
-			break;
-		
-		case DATA_DATE:
-		case DATA_UDATE:
-			errx(1, "get_value_signed: DATA_[U]DATE unimpl, call helper directly");
-			break;
-		
-		case DATA_INT8:
-			ret=helper_get_value_signed(data, 1, endian);
-			break;
-		
-		case DATA_INT16:
-			ret=helper_get_value_signed(data, 2, endian);
-			break;
-		
-		case DATA_INT32:
-			ret=helper_get_value_signed(data, 4, endian);
-			break;
-		
-		case DATA_INT64:
-			ret=helper_get_value_signed(data, 8, endian);
-			break;
-	}
+	while(set->entries[slot].ring && (set->entries[slot].ring!=ring || set->entries[slot].id!=id || set->entries[slot].found_pos!=found_pos || set->entries[slot].view!=view))
+		slot=(slot+1)&(set->nb_entries_allocated-1);
 	
-	return ret;
+	return slot;
+}
+
+static void reported_set_init(reported_set_t * const set, const uint_fast32_t nb_entries_allocated)
+{
+	set->nb_entries=0;
+	set->nb_entries_allocated=nb_entries_allocated;
+	set->entries=calloc(nb_entries_allocated, sizeof(reported_entry_t));
+	if(set->entries==NULL)
+		err(1, "calloc for reported matches failed");
 }
 
-static void test_make_message(uint8_t const * const data, const int64_t val_print, char const * const date_print, test_t const * const test, char * const message)
+//returns true if the match was already in the set
+static bool reported_set_add(reported_set_t * const set, void const * const ring, const uint32_t id, const uint_fast32_t found_pos, view_t const * const view)
 {
-	char msg_buf[100];
+	uint_fast32_t slot=reported_set_slot(set, ring, id, found_pos, view);
+	uint_fast32_t i;
 	
-	if(!test->flag_no_space)
-		strcat(message, " ");
-	if(test->message_has_argument)
+	if(set->entries[slot].ring)
+		return true;
+	
+	set->entries[slot].ring=ring;
+	set->entries[slot].id=id;
+	set->entries[slot].found_pos=found_pos;
+	set->entries[slot].view=view;
+	set->nb_entries++;
+	
+	if(2*set->nb_entries>set->nb_entries_allocated)
 	{
-		if(test->data_type==DATA_STRING)
-			sprintf(msg_buf, test->message, (char*)(data+test->offset));
-		else if(test->data_type==DATA_DATE || test->data_type==DATA_UDATE)
-			sprintf(msg_buf, test->message, date_print);
-		else
-			sprintf(msg_buf, test->message, val_print);
+		reported_set_t bigger;
+		reported_set_init(&bigger, 2*set->nb_entries_allocated);
+		for(i=0; i<set->nb_entries_allocated; i++)
+		{
+			if(set->entries[i].ring)
+				bigger.entries[reported_set_slot(&bigger, set->entries[i].ring, set->entries[i].id, set->entries[i].found_pos, set->entries[i].view)]=set->entries[i];
+		}
+		bigger.nb_entries=set->nb_entries;
+		free(set->entries);
+		(*set)=bigger;
 	}
-	else
-		sprintf(msg_buf, "%s", test->message);
-	strcat(message, msg_buf);
+	
+	return false;
 }
 
-static void test_convert_date(uint8_t const * const data, test_t const * const test, char * const date_str) //TODO TEST THIS (signed/unsigned)
+//Every match is visible in all blocks that contain it entirely. To report it exactly once we remember for each position inside the current block which match was reported there last; as positions leaving the block are never seen again a ring of blocksize entries is enough.
+static bool match_already_reported(uint_fast32_t * const reported, const uint_fast32_t blocksize, const uint_fast32_t found_pos)
 {
-	int32_t unixtime_signed;
-	uint32_t unixtime_unsigned;
-	int64_t unixtime64;
+	uint_fast32_t * const slot=&reported[found_pos%blocksize];
 	
-	switch(test->data_type)
-	{
-		case DATA_DATE: //signed
-			unixtime_signed=helper_get_value_signed(data, 4, test->endian);
-			unixtime64=unixtime_signed;
-			break;
-		
-		case DATA_UDATE: //unsigned
-			unixtime_unsigned=helper_get_value_unsigned(data, 4, test->endian);
-			unixtime64=unixtime_unsigned;
-			break;
-		
-		default:
-			errx(1, "test_convert_data: invalid data_type");
-			break;
-	}
+	if(reported_set)
+		return reported_set_add(reported_set, reported, 0, found_pos, input_view);
+	
+	if((*slot)==found_pos+1) //+1 so a zeroed ring means "nothing reported"
+		return true;
 	
-	ctime_r(&unixtime64, date_str);
+	(*slot)=found_pos+1;
+	return false;
 }
 
-static testresult_t make_test(uint8_t const * const data, test_t const * const test, const uint_fast32_t blocksize, char * const message)
+//the same for a search with many patterns: a single ring, each position keeps the (few) patterns that matched there, so memory doesn't grow with the number of patterns
+static bool pattern_already_reported(reported_slot_t * const ring, const uint_fast32_t blocksize, const uint_fast32_t found_pos, const uint32_t id)
 {
-	bool test_done=false;
-	bool is_signed=false;
-	bool result=false;
-	bool force_true=false;
+	reported_slot_t * const slot=&ring[found_pos%blocksize];
+	uint32_t i;
 	
-	int64_t val_s;
-	uint64_t val_u;
-	int64_t val_print=0;
-	char date_str[SZ_DATE_STR];
+	if(reported_set)
+		return reported_set_add(reported_set, ring, id, found_pos, input_view);
 	
-	static bool warning_printed=false;
+	if(slot->found_pos!=found_pos+1)
+	{
+		slot->found_pos=found_pos+1;
+		slot->nb_ids=0;
+	}
 	
-	if(test->offset>blocksize)
+	for(i=0; i<slot->nb_ids; i++)
 	{
-		if(!warning_printed)
-		{
-			warning_printed=true;
-			printf("warning: blocksize is to small for at least one test\n\n");
-		}
-		
-		message[0]='\0'; //dont return any message here as it would spam the user with the same message again and again if option --show-invalid was specified
-		
-		return TEST_INVALID;
-	}		
+		if(slot->ids[i]==id)
+			return true;
+	}
 	
-	switch(test->data_type)
+	reported_slot_add(slot, id);
+	return false;
+}
+
+//what to do with the hits of libfsfuzz
+typedef struct
+{
+	uint_fast32_t blocksize;
+	bool show_invalid;
+	bool verify;
+	bool match_entire_word;
+	clusterer_t * clusterer;
+	extractor_t * extractor;
+	invalid_summary_t * invalid_summary;
+	uint_fast32_t * string_reported;
+	bool * success;
+} report_t;
+
+static void report_hit(hit_t const * const hit, uint8_t const * const data, void * const userdata)
+{
+	report_t const * const report=userdata;
+	char message[SZ_MESSAGE];
+	const uint_fast32_t offset=raw_offset(hit->offset);
+	
+	switch(hit->type)
 	{
-		case DATA_STRING:
-			switch(test->test_type)
+		case HIT_MAGIC:
+			if(hit->verify_status!=VERIFY_REJECTED)
+				(*report->success)=true;
+			
+			if(output_jsonl)
 			{
-				case TEST_EQUAL:
-					if(!memcmp(data+test->offset, test->string.bytes, test->string.nb_bytes))
-						result=true;
-					break;
-				
-				case TEST_NOT_VALUE:
-					if(memcmp(data+test->offset, test->string.bytes, test->string.nb_bytes))
-						result=true;
-					break;
+				jsonl_write_magic(output_jsonl, offset, hit->ind_magic, magic[hit->ind_magic].tests[0].message, true, report->verify?verify_status_names[hit->verify_status]:NULL, hit->fs_size, hit->message, hit->values, hit->nb_values);
+				if(report->clusterer && hit->verify_status!=VERIFY_REJECTED)
+					clusterer_add(report->clusterer, get_magic_family(hit->ind_magic), offset, hit->ind_magic, hit->message);
+			}
+			else
+			{
+				strcpy(message, hit->message);
+				if(report->verify)
+				{
+					size_t len=strlen(message);
+					while(len>0 && isspace((unsigned char)message[len-1]))
+						message[--len]='\0'; //dates end with a newline
+					snprintf(message+len, sizeof(message)-len, " [%s]", verify_status_names[hit->verify_status]);
+				}
 				
-				default:
-					errx(1, "make_test: unimpl test for DATA_STRING");
-					break;
+				if(report->clusterer && hit->verify_status!=VERIFY_REJECTED) //don't let false positives hide inside a region
+					clusterer_add(report->clusterer, get_magic_family(hit->ind_magic), offset, hit->ind_magic, message);
+				else
+					printf("0x%lx (%lu)%s:%s\n", offset, offset, view_label(), message);
 			}
-			test_done=true;
+			
+			if(report->extractor && hit->verify_status!=VERIFY_REJECTED && hit->fs_size)
+				extract_region(report->extractor, hit->offset, hit->fs_size, hit->verify_status==VERIFY_VERIFIED, magic[hit->ind_magic].tests[0].message);
 			break;
 		
-		case DATA_DATE:
-		case DATA_UDATE:
-			test_convert_date(data+test->offset, test, date_str);
-			test_done=true; //FIXME add tests for this data type
-			result=true;
-			break;
+		case HIT_INVALID:
+			if(report->invalid_summary)
+				invalid_summary_add(report->invalid_summary, hit->ind_magic, hit->ind_test, offset);
 			
-		
-		case DATA_INT8:
-		case DATA_INT16:
-		case DATA_INT32:
-		case DATA_INT64:
-			is_signed=true;
+			if(report->show_invalid)
+			{
+				if(output_jsonl)
+					jsonl_write_magic(output_jsonl, offset, hit->ind_magic, magic[hit->ind_magic].tests[0].message, false, NULL, 0, hit->message, hit->values, hit->nb_values);
+				else
+					printf("[INVALID]: 0x%lx (%lu)%s:%s\n", offset, offset, view_label(), hit->message);
+			}
 			break;
 		
-		case DATA_UINT8:
-		case DATA_UINT16:
-		case DATA_UINT32:
-		case DATA_UINT64:
+		case HIT_STRING:
+			(*report->success)=true;
+			
+			if(match_already_reported(report->string_reported, report->blocksize, hit->offset)) //don't spam user with duplicate matches
+				return;
+			
+			if(report->match_entire_word && !output_jsonl) //no context around a whole word, print_stringmatch() writes the JSONL record
+				printf("0x%lx (%lu)%s: stringmatch: %s\n", offset, offset, view_label(), hit->message);
+			else
+				print_stringmatch(data, report->blocksize, hit->match_index, strlen(hit->message), hit->offset, "stringmatch", hit->message);
 			break;
 	}
+}
+
+typedef enum
+{
+	ENCODING_ASCII,
+	ENCODING_UTF16LE,
+	ENCODING_UTF16BE,
+	NB_ENCODINGS
+} encoding_t;
+
+static char const * const encoding_names[NB_ENCODINGS]={ "ascii", "utf16le", "utf16be" };
+
+//all patterns of --strings-file or all forms of --string, searched in a single pass
+typedef struct
+{
+	ac_t ac;
+	bool numbered; //patterns from --strings-file are printed with their number
+	bool match_entire_word;
+	uint32_t state; //carried over from block to block with --position-independent
+	reported_slot_t * reported; //blocksize entries, see pattern_already_reported()
+} stringset_t;
+
+//every pattern is added once per requested encoding, all forms end up in the same automaton
+static void stringset_add(stringset_t * const set, uint8_t const * const bytes, const uint_fast32_t nb_bytes, char const * const name, const uint_fast32_t number, const uint_fast8_t encodings)
+{
+	uint8_t buf[AC_PATTERN_LEN_MAX];
+	uint_fast8_t enc;
+	uint_fast32_t i, len;
+	const uint_fast32_t nb_bytes_term=nb_bytes+(set->match_entire_word?1:0); //terminating 0 is part of the pattern, like for fsfuzz_search_string()
 	
-	if(is_signed && !test_done)
+	for(enc=0; enc<NB_ENCODINGS; enc++)
 	{
-		val_s=get_value_signed(data+test->offset, test->data_type, test->endian);
-		switch(test->operation_on_value)
+		if(!(encodings&(1<<enc)))
+			continue;
+		
+		len=(enc==ENCODING_ASCII)?nb_bytes_term:2*nb_bytes_term;
+		if(len>AC_PATTERN_LEN_MAX)
+			errx(1, "pattern \"%s\" is too long as %s (max %u bytes)", name, encoding_names[enc], AC_PATTERN_LEN_MAX);
+		
+		for(i=0; i<nb_bytes_term; i++)
 		{
-			case DATAOP_NONE:
-				break;
+			uint8_t c=(i<nb_bytes)?bytes[i]:0;
 			
-			case DATAOP_AND:
-				errx(1, "make_test: can't do DATAOP_AND on signed");
-				break;
-			
-			case DATAOP_MULTIPLY:
-				errx(1, "make_test: can't do DATAOP_MULTIPLY on signed");
-				break;
+			switch(enc)
+			{
+				case ENCODING_ASCII: buf[i]=c; break;
+				case ENCODING_UTF16LE: buf[2*i]=c; buf[2*i+1]=0; break;
+				case ENCODING_UTF16BE: buf[2*i]=0; buf[2*i+1]=c; break;
+			}
 		}
+		
+		ac_add_pattern(&set->ac, buf, len, name, number*NB_ENCODINGS+enc);
 	}
+}
+
+static uint_fast8_t parse_encodings(char const * const list)
+{
+	uint_fast8_t encodings=0;
+	char buf[SZ_FILENAME_MAX+1];
+	char * tok;
+	uint_fast8_t enc;
+	
+	strncpy(buf, list, SZ_FILENAME_MAX);
+	buf[SZ_FILENAME_MAX]='\0';
 	
-	if(is_signed)
+	for(tok=strtok(buf, ","); tok; tok=strtok(NULL, ","))
 	{
-		test_done=true;
-		switch(test->test_type)
+		if(!strcmp(tok, "all"))
 		{
-			case TEST_TRUE:
-				force_true=true;
-				break;
-			
-			case TEST_EQUAL:
-				if(val_s==test->value_signed)
-					result=true;
-				break;
-			
-			case TEST_LESS_THAN:
-				if(val_s<test->value_signed)
-					result=true;
-				break;
-			
-			case TEST_MORE_THAN:
-				if(val_s>test->value_signed)
-					result=true;
-				break;
-			
-			case TEST_BITS_SET:
-				if((val_s&test->value_signed)==test->value_signed)
-					result=true;
-				break;
-			
-			case TEST_NOT_VALUE:
-				if(val_s!=test->value_signed)
-					result=true;
+			encodings=(1<<NB_ENCODINGS)-1;
+			continue;
+		}
+		
+		for(enc=0; enc<NB_ENCODINGS; enc++)
+		{
+			if(!strcmp(tok, encoding_names[enc]))
 				break;
 		}
-		val_print=val_s;
+		if(enc==NB_ENCODINGS)
+			errx(1, "unknown encoding \"%s\" (try ascii, utf16le, utf16be or all)", tok);
+		encodings|=(1<<enc);
 	}
+	
+	if(!encodings)
+		errx(1, "no encoding given");
+	
+	return encodings;
+}
 
-	if(!is_signed && !test_done)
+typedef struct
+{
+	uint8_t const * data;
+	uint_fast32_t startpos;
+	uint_fast32_t blocksize;
+	stringset_t const * set;
+	bool * success;
+} strings_search_t;
+
+static void strings_match_callback(ac_pattern_t const * const pattern, const uint_fast32_t id, const uint_fast32_t pos, void * const userdata)
+{
+	strings_search_t * const search=userdata;
+	stringset_t const * const set=search->set;
+	uint_fast32_t found_pos=search->startpos+pos;
+	const encoding_t enc=pattern->tag%NB_ENCODINGS;
+	char label[48];
+	char match[AC_PATTERN_LEN_MAX+1];
+	uint_fast32_t i, nb_chars;
+	
+	(*search->success)=true;
+	
+	if(pattern_already_reported(set->reported, search->blocksize, found_pos, id)) //don't spam user with duplicate matches
+		return;
+	
+	//show what was actually found (case may differ), UTF-16 is shown as the characters only
+	nb_chars=(enc==ENCODING_ASCII)?pattern->nb_bytes:pattern->nb_bytes/2;
+	if(set->match_entire_word)
+		nb_chars--;
+	for(i=0; i<nb_chars; i++)
 	{
-		val_u=get_value_unsigned(data+test->offset, test->data_type, test->endian);
-		switch(test->operation_on_value)
+		switch(enc)
 		{
-			case DATAOP_NONE:
-				break;
-			
-			case DATAOP_AND:
-				val_u&=test->operand;
-				break;
-			
-			case DATAOP_MULTIPLY:
-				val_u*=test->operand;
-				break;
+			case ENCODING_ASCII: match[i]=search->data[pos+i]; break;
+			case ENCODING_UTF16LE: match[i]=search->data[pos+2*i]; break;
+			case ENCODING_UTF16BE: match[i]=search->data[pos+2*i+1]; break;
+			default: break;
 		}
 	}
-		
-	if(!is_signed && !test_done)
+	match[nb_chars]='\0';
+	fsfuzz_mask_unprintable(match, nb_chars);
+	
+	strcpy(label, "stringmatch");
+	if(set->numbered)
+		sprintf(label+strlen(label), " #%lu", pattern->tag/NB_ENCODINGS);
+	if(enc!=ENCODING_ASCII)
+		sprintf(label+strlen(label), " (%s)", encoding_names[enc]);
+	
+	if(set->match_entire_word)
+		printf("0x%lx (%lu)%s: %s: %s\n", raw_offset(found_pos), raw_offset(found_pos), view_label(), label, match);
+	else
+		print_stringmatch(search->data, search->blocksize, pos, pattern->nb_bytes, found_pos, label, match);
+}
+
+static void do_search_strings(uint8_t const * const data, const uint_fast32_t startpos, const uint_fast32_t blocksize, stringset_t * const set, const bool only_new_bytes, bool * const success)
+{
+	strings_search_t search={ data, startpos, blocksize, set, success };
+	
+	if(only_new_bytes) //just feed the byte that entered the block, the automaton state is carried over from the last block
+		ac_scan(&set->ac, data, blocksize-1, blocksize, &set->state, strings_match_callback, &search);
+	else
 	{
-		test_done=true;
-		switch(test->test_type)
-		{
-			case TEST_TRUE:
-				force_true=true;
-				break;
-			
-			case TEST_EQUAL:
-				if(val_u==test->value_unsigned)
-					result=true;
-				break;
-			
-			case TEST_LESS_THAN:
-				if(val_u<test->value_unsigned)
-					result=true;
-				break;
-			
-			case TEST_MORE_THAN:
-				if(val_u>test->value_unsigned)
-					result=true;
-				break;
-			
-			case TEST_BITS_SET:
-				if((val_u&test->value_unsigned)==test->value_unsigned)
-					result=true;
-				break;
-			
-			case TEST_NOT_VALUE:
-				if(val_u!=test->value_unsigned)
-					result=true;
-				break;
-		}
-		val_print=val_u;
+		set->state=0;
+		ac_scan(&set->ac, data, 0, blocksize, &set->state, strings_match_callback, &search);
 	}
-			
-	if(force_true)
+}
+
+static void stringset_finish(stringset_t * const set, const uint_fast32_t blocksize)
+{
+	uint_fast32_t i;
+	
+	for(i=0; i<set->ac.nb_patterns; i++)
 	{
-		test_make_message(data, val_print, date_str, test, message);		
-		return TEST_SUCCESS;
+		if(set->ac.patterns[i].nb_bytes>blocksize)
+			errx(1, "string \"%s\" is longer than blocksize", set->ac.patterns[i].name);
 	}
 	
-	if(result)
+	ac_compile(&set->ac);
+	
+	set->state=0;
+	set->reported=calloc(blocksize, sizeof(reported_slot_t));
+	if(set->reported==NULL)
+		err(1, "calloc for reported strings failed");
+}
+
+static void stringset_free(stringset_t * const set, const uint_fast32_t blocksize)
+{
+	uint_fast32_t i;
+	
+	ac_free(&set->ac);
+	for(i=0; i<blocksize; i++)
+		free(set->reported[i].ids);
+	free(set->reported);
+}
+
+typedef struct
+{
+	uint8_t const * data;
+	uint_fast32_t startpos;
+	uint_fast32_t blocksize;
+	uint_fast32_t id;
+	bool last_block;
+	uint_fast32_t * reported; //blocksize entries for this regex
+	bool * success;
+} regex_search_t;
+
+static void regex_match_callback(const uint_fast32_t match_start, const uint_fast32_t match_end, const bool truncated, void * const userdata)
+{
+	regex_search_t * const search=userdata;
+	uint_fast32_t found_pos=search->startpos+match_start;
+	uint_fast32_t len=match_end-match_start;
+	char label[24];
+	char match[SZ_REGEXMATCH_PRINT_MAX+4]; //+"..."
+	
+	//a match at the start of the block or one that could go on after its end may be part of a longer one, it is reported complete from a block further left or right
+	if((match_start==0 && search->startpos!=0) || (truncated && !search->last_block))
+		return;
+	
+	(*search->success)=true;
+	
+	if(match_already_reported(search->reported, search->blocksize, found_pos))
+		return;
+	
+	if(len>SZ_REGEXMATCH_PRINT_MAX)
+	{
+		memcpy(match, search->data+match_start, SZ_REGEXMATCH_PRINT_MAX);
+		fsfuzz_mask_unprintable(match, SZ_REGEXMATCH_PRINT_MAX);
+		strcpy(match+SZ_REGEXMATCH_PRINT_MAX, "...");
+	}
+	else
 	{
-		if(test->tag_invalid)
+		memcpy(match, search->data+match_start, len);
+		match[len]='\0';
+		fsfuzz_mask_unprintable(match, len);
+	}
+	
+	sprintf(label, "regexmatch #%lu", search->id);
+	print_stringmatch(search->data, search->blocksize, match_start, len, found_pos, label, match);
+}
+
+static void do_search_regex(uint8_t const * const data, const uint_fast32_t startpos, const uint_fast32_t blocksize, regexdfa_t * const regexes, const uint_fast32_t nb_regexes, const bool last_block, uint_fast32_t * const reported, bool * const success)
+{
+	uint_fast32_t i;
+	
+	for(i=0; i<nb_regexes; i++)
+	{
+		regex_search_t search={ data, startpos, blocksize, i, last_block, &reported[i*blocksize], success };
+		regexdfa_search(&regexes[i], data, blocksize, regex_match_callback, &search);
+	}
+}
+
+static void load_strings_file(stringset_t * const set, char const * const filename, const uint_fast8_t encodings)
+{
+	char line[SZ_STRINGSFILE_LINE_MAX];
+	uint8_t bytes[AC_PATTERN_LEN_MAX];
+	uint_fast32_t nb_bytes;
+	uint_fast32_t linenumber=0;
+	uint_fast32_t number=0;
+	size_t i;
+	
+	FILE * inp=fopen(filename, "r");
+	if(!inp)
+		err(1, "can't open \"%s\"", filename);
+	
+	while(fgets(line, SZ_STRINGSFILE_LINE_MAX, inp))
+	{
+		linenumber++;
+		line[strcspn(line, "\r\n")]='\0';
+		
+		if(line[0]=='\0' || line[0]=='#') //empty lines and comments
+			continue;
+		
+		//same escapes as in file "filesystems": \xHH for any byte, \\ for a backslash (and \# for a pattern starting with '#')
+		nb_bytes=0;
+		for(i=0; line[i]!='\0'; i++)
 		{
-			//even if the result is invalid process the message, might be useful (and even needed for option --show-invalid)
-			test_make_message(data, val_print, date_str, test, message);
-			return TEST_INVALID;
+			if(nb_bytes==AC_PATTERN_LEN_MAX)
+				errx(1, "%s:%lu: pattern too long (max %u bytes)", filename, linenumber, AC_PATTERN_LEN_MAX);
+			
+			if(line[i]=='\\' && line[i+1]=='x' && isxdigit((unsigned char)line[i+2]) && isxdigit((unsigned char)line[i+3]))
+			{
+				char hex[3]={ line[i+2], line[i+3], '\0' };
+				bytes[nb_bytes++]=strtoul(hex, NULL, 16);
+				i+=3;
+			}
+			else if(line[i]=='\\' && line[i+1]!='\0')
+				bytes[nb_bytes++]=line[++i];
+			else
+				bytes[nb_bytes++]=line[i];
 		}
+		
+		if(nb_bytes<2)
+			errx(1, "%s:%lu: pattern is too short", filename, linenumber);
+		
+		stringset_add(set, bytes, nb_bytes, line, number++, encodings);
+	}
+	
+	fclose(inp);
+	
+	if(number==0)
+		errx(1, "no patterns found in \"%s\"", filename);
+}
+
+//developer tools: --golden and --microbench
+
+static uint32_t dev_lcg(uint32_t * const state)
+{
+	(*state)=(*state)*1103515245+12345;
+	return (*state)>>8;
+}
+
+static void dev_fill_random(uint8_t * const data, const uint_fast32_t len, uint32_t seed)
+{
+	uint_fast32_t i;
+	
+	for(i=0; i<len; i++)
+		data[i]=dev_lcg(&seed);
+}
+
+static void helper_put_value(uint8_t * const data, const uint_fast8_t nb_bytes, const endian_t endian, const uint64_t value)
+{
+	uint_fast8_t i;
+	
+	for(i=0; i<nb_bytes; i++)
+	{
+		if(endian==ENDIAN_BE)
+			data[nb_bytes-i-1]=value>>(8*i);
 		else
-		{
-			test_make_message(data, val_print, date_str, test, message);
-			return TEST_SUCCESS;
-		}
+			data[i]=value>>(8*i);
 	}
-	else
-		return TEST_FAILURE;
 }
 
-static void search_magic(uint8_t const * const data, const uint_fast32_t startpos, const uint_fast32_t blocksize, const bool show_invalid, bool * const success)
+static uint_fast8_t get_data_size(const datatype_t type)
+{
+	switch(type)
+	{
+		case DATA_INT8: case DATA_UINT8: return 1;
+		case DATA_INT16: case DATA_UINT16: return 2;
+		case DATA_DATE: case DATA_UDATE: case DATA_INT32: case DATA_UINT32: return 4;
+		case DATA_INT64: case DATA_UINT64: return 8;
+		default: return 0;
+	}
+}
+
+//an indirect offset that points outside the block is made to point to the middle of it
+static void golden_fix_pointer(uint8_t * const data, test_t const * const test, const uint64_t parent_end)
+{
+	uint64_t offset;
+	
+	if(!test->offset_indirect || fsfuzz_resolve_offset(data, test, GOLDEN_BLOCKSIZE, parent_end, &offset))
+		return;
+	
+	offset=test->offset_relative?test->offset+parent_end:test->offset;
+	if(offset+8>GOLDEN_BLOCKSIZE)
+		return;
+	helper_put_value(data+offset, get_data_size(test->indirect_type), test->indirect_endian, GOLDEN_BLOCKSIZE/2-test->indirect_adjust);
+}
+
+//write bytes at the place of the test so that fsfuzz_make_test() returns true for it (if possible, some combinations like "<0" can't be satisfied), returns the end of the data for relative offsets of its child tests
+static uint64_t golden_satisfy_test(uint8_t * const data, test_t const * const test, const uint64_t parent_end)
 {
+	uint64_t value=test->value_unsigned; //same bits for signed values
+	uint64_t offset=test->offset;
+	
+	golden_fix_pointer(data, test, parent_end);
+	if((test->offset_relative || test->offset_indirect) && !fsfuzz_resolve_offset(data, test, GOLDEN_BLOCKSIZE, parent_end, &offset))
+		return 0;
+	
+	if(test->test_type==TEST_TRUE || test->data_type==DATA_DATE || test->data_type==DATA_UDATE)
+		return offset+get_data_size(test->data_type);
+	
+	if(test->data_type==DATA_STRING)
+	{
+		memcpy(data+offset, test->string.bytes, test->string.nb_bytes);
+		if(test->test_type==TEST_NOT_VALUE)
+			data[offset]^=0xff;
+		return offset+test->string.nb_bytes;
+	}
+	
+	switch(test->test_type)
+	{
+		case TEST_LESS_THAN: value--; break;
+		case TEST_MORE_THAN: value++; break;
+		case TEST_NOT_VALUE: value++; break;
+		default: break;
+	}
+	
+	if(test->operation_on_value==DATAOP_MULTIPLY && test->operand)
+		value/=test->operand;
+	
+	helper_put_value(data+offset, get_data_size(test->data_type), test->endian, value);
+	
+	return offset+get_data_size(test->data_type);
+}
+
+//For every entry of the magic-database a block of pseudo-random bytes is made and then the tests 0...v-1 are satisfied one after another, for every v. The hits (valid and invalid) found at each step are printed so the listing can be compared to the one made before changing the matcher.
+static void run_golden(void)
+{
+	uint8_t * block=malloc(GOLDEN_BLOCKSIZE);
+	uint8_t * variant=malloc(GOLDEN_BLOCKSIZE);
+	uint64_t level_end[NB_LEVELS_MAX+1];
 	uint_fast32_t ind_magic;
-	uint_fast8_t ind_tests, old_ind_tests;
-	uint_fast8_t current_level;
-	bool level_down;
-	bool is_invalid;
-	char message[1024]; //1kB should be enough i guess
+	uint_fast8_t v;
+	bool success;
+	report_t report={ .blocksize=GOLDEN_BLOCKSIZE, .show_invalid=true, .verify=true, .success=&success };
+	fsfuzz_t engine;
+	
+	if(block==NULL || variant==NULL)
+		err(1, "malloc for golden blocks failed");
+	
+	fsfuzz_init(&engine, GOLDEN_BLOCKSIZE);
+	engine.verify=true;
+	engine.report_invalid=true;
+	engine.on_hit=report_hit;
+	engine.hit_userdata=&report;
 	
 	for(ind_magic=0; ind_magic<NB_ENTRIES_MAGIC; ind_magic++)
 	{
-		bool once_succeeded[NB_LEVELS_MAX]={0};
-		
-		current_level=0;
-		level_down=false;
-		is_invalid=false;
-		message[0]='\0';
+		dev_fill_random(block, GOLDEN_BLOCKSIZE, GOLDEN_SEED+ind_magic);
+		memcpy(variant, block, GOLDEN_BLOCKSIZE);
 		
-		//this block was a pain to get right and might benefit from some cleanup...
-		for(ind_tests=0; ind_tests<magic[ind_magic].nb_tests; )
+		for(v=0; v<=magic[ind_magic].nb_tests; v++)
 		{
-			current_level=magic[ind_magic].tests[ind_tests].level;
-			testresult_t res=make_test(data, &magic[ind_magic].tests[ind_tests], blocksize, message);
-			if(res==TEST_INVALID)
+			if(v>0)
 			{
-				is_invalid=true;
-				break;
-			}
-			else if(res==TEST_SUCCESS)
-			{
-				once_succeeded[current_level]=true;
-				
-				//check if next test in database has the same or a higher level
-				ind_tests++;
-				if(ind_tests<magic[ind_magic].nb_tests && magic[ind_magic].tests[ind_tests].level>=current_level)
-					continue; //if so execute test
-				else if(current_level>0)
-					level_down=true; //next test is lower level -> going down one level
-				else
-					break; //we are at level 0 and there is no other test with same or higher level -> stop
-			}
-			if(res==TEST_FAILURE || level_down)
-			{
-				if(current_level>0 && once_succeeded[current_level-1])
-				{
-					old_ind_tests=ind_tests;
-					if(res==TEST_FAILURE)
-					{
-						//failure but success at last level, continue on same level if there are more tests
-						do
-						{
-							ind_tests++;
-						} while(ind_tests<magic[ind_magic].nb_tests && magic[ind_magic].tests[ind_tests].level>current_level);
-					}
-					
-					//check if no other test on same level found
-					if(ind_tests==magic[ind_magic].nb_tests)
-					{
-						//go one level down
-						ind_tests=old_ind_tests;
-						do
-						{
-							ind_tests++;
-						} while(ind_tests<magic[ind_magic].nb_tests && magic[ind_magic].tests[ind_tests].level!=(current_level-1));
-					}
-				}
-				else
-					break; //stop
+				test_t const * const test=&magic[ind_magic].tests[v-1];
+				level_end[test->level]=golden_satisfy_test(variant, test, test->level?level_end[test->level-1]:0);
 			}
+			
+			printf("entry #%lu variant %u:\n", ind_magic, v);
+			fsfuzz_search_magic(&engine, variant, 0);
 		}
-		
-		if(!is_invalid && strlen(message))
+	}
+	
+	fsfuzz_free(&engine);
+	free(block);
+	free(variant);
+}
+
+static uint64_t get_elapsed_ns(struct timespec const * const start)
+{
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return (now.tv_sec-start->tv_sec)*1000000000ULL+now.tv_nsec-start->tv_nsec;
+}
+
+static void run_microbench(const uint_fast32_t blocksize)
+{
+	uint8_t * data=malloc(MICROBENCH_NB_OFFSETS+blocksize);
+	uint_fast32_t * reported=calloc(blocksize, sizeof(uint_fast32_t));
+	uint_fast32_t i, ind_magic;
+	uint64_t nb_calls=0;
+	struct timespec start;
+	volatile uint_fast32_t sink=0; //keep the compiler from throwing away results
+	char message[SZ_MESSAGE];
+	test_value_t value;
+	fsfuzz_t engine;
+	
+	if(data==NULL || reported==NULL)
+		err(1, "malloc for microbench failed");
+	
+	fsfuzz_init(&engine, blocksize); //no callback, nothing is printed
+	engine.searchstring="fsfuzz";
+	
+	dev_fill_random(data, MICROBENCH_NB_OFFSETS+blocksize, GOLDEN_SEED);
+	
+	//fsfuzz_make_test on the first test of every entry, this is what is done for nearly all offsets
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(i=0; i<MICROBENCH_NB_BLOCKS; i++)
+	{
+		for(ind_magic=0; ind_magic<NB_ENTRIES_MAGIC; ind_magic++)
 		{
-			(*success)=true;
-			printf("0x%lx (%lu):%s\n", startpos, startpos, message);
+			if(magic[ind_magic].tests[0].offset+NB_BYTES_MAX>blocksize)
+				continue;
+			message[0]='\0';
+			sink+=fsfuzz_make_test(data+i, &magic[ind_magic].tests[0], blocksize, 0, message, &value);
+			nb_calls++;
 		}
-		else if(is_invalid && show_invalid && strlen(message))
-			printf("[INVALID]: 0x%lx (%lu):%s\n", startpos, startpos, message);
 	}
+	printf("fsfuzz_make_test (level 0): %.1f ns/call\n", (double)get_elapsed_ns(&start)/nb_calls);
+	
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(i=0; i<MICROBENCH_NB_OFFSETS; i++)
+		fsfuzz_search_magic(&engine, data+i, i);
+	printf("fsfuzz_search_magic: %.1f ns/offset\n", (double)get_elapsed_ns(&start)/MICROBENCH_NB_OFFSETS);
+	
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(i=0; i<MICROBENCH_NB_OFFSETS; i++)
+		fsfuzz_search_string(&engine, data+i, i, false, reported);
+	printf("fsfuzz_search_string (whole block): %.1f ns/offset\n", (double)get_elapsed_ns(&start)/MICROBENCH_NB_OFFSETS);
+	
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(i=0; i<MICROBENCH_NB_OFFSETS; i++)
+		fsfuzz_search_string(&engine, data+i, i, i>0, reported);
+	printf("fsfuzz_search_string (new bytes only): %.1f ns/offset\n", (double)get_elapsed_ns(&start)/MICROBENCH_NB_OFFSETS);
+	
+	(void)sink;
+	fsfuzz_free(&engine);
+	free(data);
+	free(reported);
+}
+
+static void decrypt_init(const uint_fast32_t blocksize)
+{
+	if(decrypt_blocksize==blocksize)
+		return;
+	
+	if(decrypt_blocksize)
+		user_decrypt_cleanup();
+	
+	user_decrypt_init(blocksize);
+	decrypt_blocksize=blocksize;
 }
 
-static void mask_unprintable(char * const str, ssize_t len)
+static void handle_interrupt(int sig)
 {
-	if(len)
-		len--; //don't touch terminating '\0'!
+	(void)sig;
+	interrupted=1;
+}
+
+//--resume is the only argument that may differ between the interrupted and the resumed run
+static uint64_t get_options_hash(const int argc, char * const argv[])
+{
+	uint64_t hash=0;
+	int i;
 	
-	while(len>=0)
+	for(i=1; i<argc; i++)
 	{
-		if(str[len]<0x20 || str[len]>0x7E)
-			str[len]='?';
-		len--;
+		if(strcmp(argv[i], "--resume"))
+			hash=xxh64(argv[i], strlen(argv[i])+1, hash);
 	}
+	
+	return hash;
 }
 
-static void do_search_string(uint8_t const * const data, const uint_fast32_t startpos, const uint_fast32_t blocksize, char const * const searchstring, const bool match_entire_word, bool * const success)
+//for --cache: where the dump comes from and where the results go doesn't change them
+static uint64_t get_cache_options_hash(const int argc, char * const argv[])
 {
-	size_t len=strlen(searchstring)+(match_entire_word?1:0); //we can do this match_entire_word-stuff because in C the string will always be 0 terminated
-	uint_fast32_t offset=0;
-	uint8_t * ptr;
-	uint_fast32_t found_pos;
-	static uint_fast32_t last_pos=0;
+	static char const * const not_hashed[]={ "--file", "--cache", "--files", "--results", "--jobs", NULL };
+	uint64_t hash=0;
+	int i;
+	uint_fast8_t j;
 	
-	do //we need a loop as there can be several matches inside the block
+	for(i=1; i<argc; i++)
 	{
-		ptr=memmem(data+offset, blocksize-offset, searchstring, len);
-		
-		if(ptr==NULL) //no match in entire block
-			return;
-
-		(*success)=true;
-		
-		found_pos=startpos+ptr-data;
-		
-		if(found_pos==last_pos) //don't spam user with duplicate matches
-		{
-			offset++;
-			continue;
-		}
-		
-		if(match_entire_word)
+		for(j=0; not_hashed[j]; j++)
 		{
-			offset+=len;
-			printf("0x%lx (%lu): stringmatch: %s\n", found_pos, found_pos, searchstring);
+			size_t len=strlen(not_hashed[j]);
+			if(!strncmp(argv[i], not_hashed[j], len) && (argv[i][len]=='\0' || argv[i][len]=='='))
+				break;
 		}
-		else
+		if(not_hashed[j])
 		{
-			char before[NB_CHARS_BEFORE_STRMATCH+1];	
-			size_t nb_chars_to_copy=NB_CHARS_BEFORE_STRMATCH;
-			if(ptr+NB_CHARS_BEFORE_STRMATCH>blocksize+data)
-				nb_chars_to_copy=blocksize-(ptr-data);
-			memcpy(before, ptr-nb_chars_to_copy, nb_chars_to_copy);
-			before[nb_chars_to_copy]='\0';
-			mask_unprintable(before, nb_chars_to_copy);
-			
-			char after[NB_CHARS_AFTER_STRMATCH+1];	
-			nb_chars_to_copy=NB_CHARS_AFTER_STRMATCH;
-			if(ptr+NB_CHARS_AFTER_STRMATCH>blocksize+data)
-				nb_chars_to_copy=blocksize-(ptr-data);
-			memcpy(after, ptr+len, nb_chars_to_copy);
-			after[nb_chars_to_copy]='\0';
-			mask_unprintable(after, nb_chars_to_copy);
-			
-			offset+=len+NB_CHARS_BEFORE_STRMATCH+NB_CHARS_AFTER_STRMATCH;
-
-			printf("0x%lx (%lu): stringmatch: %s%s%s\n", found_pos, found_pos, before, searchstring, after);
+			if(!strchr(argv[i], '='))
+				i++; //the argument
+			continue;
 		}
 		
-		last_pos=found_pos;
+		hash=xxh64(argv[i], strlen(argv[i])+1, hash);
 		
-	} while(offset<blocksize);
+		//--output jsonl $name, only "-" (stdout) makes a difference
+		if(!strcmp(argv[i], "--output") || !strncmp(argv[i], "--output=", 9))
+		{
+			if(!strcmp(argv[i], "--output") && i+1<argc)
+			{
+				i++;
+				hash=xxh64(argv[i], strlen(argv[i])+1, hash);
+			}
+			if(i+1<argc && !strcmp(argv[i+1], "-"))
+				hash=xxh64("-", 2, hash);
+			i++;
+		}
+	}
+	
+	return hash;
 }
 
 static void print_usage_and_exit(void)
 {
 	printf("usage: fsfuzz [options]\n\n");
-	printf("options:\n\t--file $name to specify input file to be examinated (MANDATORY)\n\t--blocksize $size to specify blocksize (default 2048)\n\t--nosearch to disable filesystem search\n\t--show-invalid to show invalid results (warning: output can be huge)\n\t--string \"$string\" to search for string in decrypted blocks\n\t--match-word if $string must be 0-terminated\n\n");
-	printf("caution: --string may miss stuff if blocksize is too small, but the bigger the blocksize the slower the program...\n");
+	printf("options:\n\t--file $name to specify input file to be examinated (MANDATORY)\n\t--blocksize $size to specify blocksize (default 2048)\n\t--nosearch to disable filesystem search\n\t--show-invalid to show invalid results (warning: output can be huge)\n\t--string \"$string\" to search for string in decrypted blocks\n\t--match-word if $string must be 0-terminated\n\t--strings-file $name to search for all strings in $name (one per line, \\xHH escapes allowed) in a single pass\n\t--position-independent if user_decrypt_block() decrypts a byte the same way wherever it is inside the block (makes string search much faster)\n\t--regex \"$regex\" to search for a regular expression in decrypted blocks (can be given up to %u times)\n\t--encoding $list to search strings as ascii, utf16le and/or utf16be (comma separated or \"all\", default ascii)\n\t--ignore-case to search strings case-insensitive (ASCII letters only)\n\t--entropy-map $name to write the entropy of the decrypted data per region to $name (CSV) and report sharp drops\n\t--entropy-window $size bytes at the start of each block used for entropy (default 256)\n\t--entropy-region $size offsets per line in the entropy map (default 65536)\n\t--cluster $maxgap to print repeated hits of the same filesystem family no more than $maxgap bytes apart as a single region\n\t--verify to check CRCs/consistency of JFFS2, UBI, UBIFS and Squashfs hits and mark them as verified, unverified or rejected\n\t--extract $dir to decrypt all filesystems of known size that are not rejected by --verify (implied) and write them to $dir (unverified ones only if they fit in the file)\n\t--output jsonl $name to write all results as JSON Lines to $name instead of printing them\n\t--invalid-summary[=$n] to print a table of invalid results per magic entry and test at the end, with the $n (default 5) offsets that got furthest\n\t--stats to print where the time was spent and how often each magic entry matched at the end\n\t--golden to print the results for a crafted block per magic entry and test (for checking changes to the matcher, no --file needed)\n\t--microbench to print the time per call of fsfuzz_make_test, fsfuzz_search_magic and fsfuzz_search_string for the given blocksize (no --file needed)\n\t--checkpoint $name to save the progress of the scan to $name every %u seconds and on Ctrl-C\n\t--resume to continue the scan saved with --checkpoint (use the same command line plus --resume)\n\t--start $offset to start the scan at $offset (default 0)\n\t--end $offset to stop the scan before $offset (default: end of file)\n\t--shard $i/$n to scan only part $i (0...$n-1) of $n equal parts of the file\n\t--merge $name $file1 $file2... to write the results of several partial scans (JSONL or text) ordered by offset and without duplicates to $name\n\t--aligned-first to scan offsets aligned to 128kB first, then 4kB, then 512 bytes and only then all others\n\t--max-hits $n to stop after $n filesystems were found (not counting those rejected by --verify)\n\t--sample $rate to scan only a random part $rate (0...1) of the offsets and estimate the number of hits for a full scan\n\t--time-budget $seconds to scan random offsets for $seconds and estimate the number of hits for a full scan\n\t--seed $n for the random choice of --sample and --time-budget (default 1)\n\t--files $list to scan all files listed in $list (one per line) or all files in directory $list instead of --file\n\t--results $dir to write the results of each file of --files to $dir/$name.txt (and .jsonl, .csv for --output jsonl and --entropy-map)\n\t--jobs $n to scan up to $n files of --files at the same time (default: number of CPUs)\n\t--daemon $socket to wait for requests (a line with the options for one scan) on Unix socket $socket and send the output back, up to --jobs at the same time\n\t--cache $dir to keep the results in $dir and print them again at once if the same dump is scanned with the same options and executable\n\t--baseline $name to scan only what changed compared to the old dump $name, the results for the rest are taken from --baseline-results\n\t--baseline-results $name the JSONL output of a scan of the dump of --baseline with the same options\n\t--nand-layout $page,$oob to scan a raw NAND dump without the $oob bytes of spare area after each page of $page bytes (or one of the presets 512, 2k, 2k128, 4k, 4k256, 8k)\n\t--swap16 to scan the dump with the bytes of each 16 bit word swapped\n\t--swap32 to scan the dump with the bytes of each 32 bit word reversed\n\t--deinterleave $n:$w to scan the data of each of $n chips (up to %u) that follow each other every $w bytes on their own\n\t--plain to scan the dump as it is too when --swap16, --swap32 or --deinterleave is given (all in a single pass)\n\n", NB_REGEX_MAX, CHECKPOINT_INTERVAL, NB_CHIPS_MAX);
+	printf("caution: strings are only found if they are entirely inside a decrypted block, so a bigger blocksize finds stuff further away from the start of an encrypted area (but is slower)...\n");
 	exit(0);
 }
 
@@ -599,6 +949,45 @@ int main(int argc, char * argv[])
 		{ "show-invalid",		no_argument,		NULL, 	3 },
 		{ "string",	 			required_argument,	NULL,	4 },
 		{ "match-word",			no_argument,		NULL,	5 }, //TODO find better name
+		{ "strings-file",		required_argument,	NULL,	6 },
+		{ "position-independent",	no_argument,	NULL,	7 },
+		{ "regex",				required_argument,	NULL,	8 },
+		{ "encoding",			required_argument,	NULL,	9 },
+		{ "ignore-case",		no_argument,		NULL,	10 },
+		{ "entropy-map",		required_argument,	NULL,	11 },
+		{ "entropy-window",		required_argument,	NULL,	12 },
+		{ "entropy-region",		required_argument,	NULL,	13 },
+		{ "cluster",			required_argument,	NULL,	14 },
+		{ "verify",				no_argument,		NULL,	15 },
+		{ "extract",			required_argument,	NULL,	16 },
+		{ "output",				required_argument,	NULL,	17 },
+		{ "invalid-summary",	optional_argument,	NULL,	18 },
+		{ "stats",				no_argument,		NULL,	19 },
+		{ "golden",				no_argument,		NULL,	20 },
+		{ "microbench",			no_argument,		NULL,	21 },
+		{ "checkpoint",			required_argument,	NULL,	22 },
+		{ "resume",				no_argument,		NULL,	23 },
+		{ "start",				required_argument,	NULL,	24 },
+		{ "end",				required_argument,	NULL,	25 },
+		{ "shard",				required_argument,	NULL,	26 },
+		{ "merge",				required_argument,	NULL,	27 },
+		{ "aligned-first",		no_argument,		NULL,	28 },
+		{ "max-hits",			required_argument,	NULL,	29 },
+		{ "sample",				required_argument,	NULL,	30 },
+		{ "time-budget",		required_argument,	NULL,	31 },
+		{ "seed",				required_argument,	NULL,	32 },
+		{ "files",				required_argument,	NULL,	33 },
+		{ "results",			required_argument,	NULL,	34 },
+		{ "jobs",				required_argument,	NULL,	35 },
+		{ "daemon",				required_argument,	NULL,	36 },
+		{ "cache",				required_argument,	NULL,	37 },
+		{ "baseline",			required_argument,	NULL,	38 },
+		{ "baseline-results",	required_argument,	NULL,	39 },
+		{ "nand-layout",		required_argument,	NULL,	40 },
+		{ "swap16",				no_argument,		NULL,	41 },
+		{ "swap32",				no_argument,		NULL,	42 },
+		{ "deinterleave",		required_argument,	NULL,	43 },
+		{ "plain",				no_argument,		NULL,	44 },
 		
 		{ "version",			no_argument,		NULL, 	100 },
 		{ "help",				no_argument,		NULL, 	101 },
@@ -610,6 +999,9 @@ int main(int argc, char * argv[])
 	int optionindex;
 	int opt;
 	
+	const uint64_t options_hash=get_options_hash(argc, argv); //before getopt_long() reorders anything
+	const uint64_t cache_options_hash=get_cache_options_hash(argc, argv);
+	
 	char filename[SZ_FILENAME_MAX+1];
 	bool file_specified=false;
 	uint_fast32_t blocksize=2048;
@@ -618,6 +1010,66 @@ int main(int argc, char * argv[])
 	char searchstring[SZ_SEARCHSTRING_MAX+1];
 	bool searchstring_specified=false;
 	bool match_entire_word=false;
+	char stringsfile[SZ_FILENAME_MAX+1];
+	bool stringsfile_specified=false;
+	bool position_independent=false;
+	char const * regex_patterns[NB_REGEX_MAX];
+	uint_fast32_t nb_regexes=0;
+	uint_fast8_t encodings=(1<<ENCODING_ASCII);
+	bool ignore_case=false;
+	char entropymapfile[SZ_FILENAME_MAX+1];
+	bool entropymap_specified=false;
+	uint_fast32_t entropy_window=256;
+	uint_fast32_t entropy_region=65536;
+	bool do_cluster=false;
+	uint_fast32_t cluster_max_gap=0;
+	bool verify=false;
+	char extract_dir[SZ_EXTRACT_PATH_MAX/2]={'\0'};
+	char outputfile[SZ_FILENAME_MAX+1];
+	bool output_specified=false;
+	bool do_invalid_summary=false;
+	uint_fast32_t invalid_summary_nb_top=5;
+	bool stats_specified=false;
+	bool do_golden=false;
+	bool do_microbench=false;
+	char checkpointfile[SZ_FILENAME_MAX+1];
+	bool checkpoint_specified=false;
+	bool resume=false;
+	uint_fast32_t scan_start=0;
+	uint_fast32_t scan_end=UINT_FAST32_MAX;
+	uint_fast32_t shard_index=0;
+	uint_fast32_t nb_shards=0;
+	char mergefile[SZ_FILENAME_MAX+1];
+	bool merge_specified=false;
+	bool aligned_first=false;
+	uint_fast32_t max_hits=0;
+	bool max_hits_specified=false;
+	double sample_rate=1.0;
+	bool sample_specified=false;
+	double time_budget=0;
+	bool time_budget_specified=false;
+	uint64_t seed=1;
+	char fileslist[SZ_FILENAME_MAX+1];
+	bool files_specified=false;
+	char resultsdir[SZ_FILENAME_MAX+1];
+	bool results_specified=false;
+	uint_fast32_t nb_jobs=sysconf(_SC_NPROCESSORS_ONLN);
+	int_fast32_t batch_job=-1; //in a worker of --files
+	char daemonsocket[SZ_FILENAME_MAX+1];
+	bool daemon_specified=false;
+	char cachedir[SZ_FILENAME_MAX+1];
+	bool cache_specified=false;
+	char baselinefile[SZ_FILENAME_MAX+1];
+	bool baseline_specified=false;
+	char baselineresults[SZ_FILENAME_MAX+1];
+	bool baseline_results_specified=false;
+	uint_fast32_t nand_page_size=0;
+	uint_fast32_t nand_oob_size=0;
+	bool swap16=false;
+	bool swap32=false;
+	uint_fast32_t nb_chips=0;
+	uint_fast32_t chip_width=0;
+	bool plain=false;
 	bool only_print_version=false;
 	
 	printf("This is fsfuzz version 0.1 by kittennbfive - https://github.com/kittennbfive/\n");
@@ -635,6 +1087,50 @@ int main(int argc, char * argv[])
 			case 3: show_invalid=true; break;
 			case 4: strncpy(searchstring, optarg, SZ_SEARCHSTRING_MAX); searchstring[SZ_SEARCHSTRING_MAX]='\0'; searchstring_specified=true; break;
 			case 5: match_entire_word=true; break;
+			case 6: strncpy(stringsfile, optarg, SZ_FILENAME_MAX); stringsfile[SZ_FILENAME_MAX]='\0'; stringsfile_specified=true; break;
+			case 7: position_independent=true; break;
+			case 8: if(nb_regexes==NB_REGEX_MAX) errx(1, "too many --regex (max %u)", NB_REGEX_MAX); regex_patterns[nb_regexes++]=optarg; break;
+			case 9: encodings=parse_encodings(optarg); break;
+			case 10: ignore_case=true; break;
+			case 11: strncpy(entropymapfile, optarg, SZ_FILENAME_MAX); entropymapfile[SZ_FILENAME_MAX]='\0'; entropymap_specified=true; break;
+			case 12: entropy_window=atoi(optarg); break;
+			case 13: entropy_region=atoi(optarg); break;
+			case 14: cluster_max_gap=strtoul(optarg, NULL, 0); do_cluster=true; break;
+			case 15: verify=true; break;
+			case 16: strncpy(extract_dir, optarg, SZ_EXTRACT_PATH_MAX/2-1); verify=true; break;
+			case 17:
+				if(strcmp(optarg, "jsonl"))
+					errx(1, "unknown output format \"%s\", only jsonl is supported", optarg);
+				if(optind>=argc)
+					errx(1, "--output jsonl needs a filename");
+				strncpy(outputfile, argv[optind++], SZ_FILENAME_MAX); outputfile[SZ_FILENAME_MAX]='\0'; output_specified=true; break;
+			case 18: if(optarg) invalid_summary_nb_top=atoi(optarg); do_invalid_summary=true; break;
+			case 19: stats_specified=true; break;
+			case 20: do_golden=true; break;
+			case 21: do_microbench=true; break;
+			case 22: strncpy(checkpointfile, optarg, SZ_FILENAME_MAX); checkpointfile[SZ_FILENAME_MAX]='\0'; checkpoint_specified=true; break;
+			case 23: resume=true; break;
+			case 24: scan_start=strtoul(optarg, NULL, 0); break;
+			case 25: scan_end=strtoul(optarg, NULL, 0); break;
+			case 26: if(sscanf(optarg, "%lu/%lu", &shard_index, &nb_shards)!=2 || nb_shards==0 || shard_index>=nb_shards) errx(1, "invalid argument \"%s\" for --shard, must be $i/$n with $i<$n", optarg); break;
+			case 27: strncpy(mergefile, optarg, SZ_FILENAME_MAX); mergefile[SZ_FILENAME_MAX]='\0'; merge_specified=true; break;
+			case 28: aligned_first=true; break;
+			case 29: max_hits=atoi(optarg); max_hits_specified=true; break;
+			case 30: sample_rate=atof(optarg); sample_specified=true; break;
+			case 31: time_budget=atof(optarg); time_budget_specified=true; break;
+			case 32: seed=strtoull(optarg, NULL, 0); break;
+			case 33: strncpy(fileslist, optarg, SZ_FILENAME_MAX); fileslist[SZ_FILENAME_MAX]='\0'; files_specified=true; break;
+			case 34: strncpy(resultsdir, optarg, SZ_FILENAME_MAX/2); resultsdir[SZ_FILENAME_MAX/2]='\0'; results_specified=true; break;
+			case 35: nb_jobs=atoi(optarg); break;
+			case 36: strncpy(daemonsocket, optarg, SZ_FILENAME_MAX); daemonsocket[SZ_FILENAME_MAX]='\0'; daemon_specified=true; break;
+			case 37: strncpy(cachedir, optarg, SZ_FILENAME_MAX); cachedir[SZ_FILENAME_MAX]='\0'; cache_specified=true; break;
+			case 38: strncpy(baselinefile, optarg, SZ_FILENAME_MAX); baselinefile[SZ_FILENAME_MAX]='\0'; baseline_specified=true; break;
+			case 39: strncpy(baselineresults, optarg, SZ_FILENAME_MAX); baselineresults[SZ_FILENAME_MAX]='\0'; baseline_results_specified=true; break;
+			case 40: if(!view_parse_nand_layout(optarg, &nand_page_size, &nand_oob_size)) errx(1, "invalid argument \"%s\" for --nand-layout, must be $page,$oob or one of the presets 512, 2k, 2k128, 4k, 4k256, 8k", optarg); break;
+			case 41: swap16=true; break;
+			case 42: swap32=true; break;
+			case 43: if(sscanf(optarg, "%lu:%lu", &nb_chips, &chip_width)!=2 || nb_chips<2 || nb_chips>NB_CHIPS_MAX || chip_width==0) errx(1, "invalid argument \"%s\" for --deinterleave, must be $n:$w with 2<=$n<=%u and $w>0", optarg, NB_CHIPS_MAX); break;
+			case 44: plain=true; break;
 			
 			case 100: only_print_version=true; break;
 			case 101: print_usage_and_exit(); break;
@@ -646,15 +1142,195 @@ int main(int argc, char * argv[])
 	if(only_print_version)
 		return 0;
 	
-	if(!file_specified)
+	if(do_golden)
+	{
+		run_golden();
+		return 0;
+	}
+	
+	if(merge_specified)
+	{
+		if(optind>=argc)
+			errx(1, "--merge needs at least one file to read");
+		merge_results(mergefile, &argv[optind], argc-optind);
+		return 0;
+	}
+	
+	if(do_microbench)
+	{
+		if(blocksize<128)
+			errx(1, "blocksize is NaN or too small");
+		run_microbench(blocksize);
+		return 0;
+	}
+	
+	if(daemon_specified)
+	{
+		if(daemon_worker)
+			errx(1, "--daemon can't be used in a request");
+		
+		if(file_specified || files_specified)
+			errx(1, "--daemon gets the files with the requests, --file and --files can't be used");
+		
+		if(blocksize<128)
+			errx(1, "blocksize is NaN or too small");
+		
+		if(nb_jobs==0)
+			errx(1, "number of jobs is NaN or 0");
+		
+		decrypt_init(blocksize); //once for all requests with this blocksize
+		
+		if(!daemon_run(daemonsocket, nb_jobs, argv[0], &argc, &argv))
+		{
+			user_decrypt_cleanup();
+			printf("\nall done - bye\n\n");
+			return 0;
+		}
+		
+		//this is a worker now, start over with the options of the request
+		daemon_worker=true;
+		optind=0; //makes getopt_long() start from scratch
+		return main(argc, argv);
+	}
+	
+	if(!file_specified && !files_specified)
 		errx(1, "--file is missing but mandatory (try --help)");
 	
+	if(file_specified && files_specified)
+		errx(1, "--file and --files can't be used together");
+	
+	if(files_specified && !results_specified)
+		errx(1, "--files needs --results $dir");
+	
+	if(files_specified && nb_jobs==0)
+		errx(1, "number of jobs is NaN or 0");
+	
+	if(files_specified && checkpoint_specified)
+		errx(1, "--checkpoint can't be used with --files");
+	
+	//the output of these is not only what is printed and the JSONL output, or it depends on the time
+	if(cache_specified && (checkpoint_specified || strlen(extract_dir) || entropymap_specified || stats_specified || time_budget_specified))
+		errx(1, "--cache can't be combined with --checkpoint, --extract, --entropy-map, --stats or --time-budget");
+	
+	if(output_specified && !strcmp(outputfile, "-") && checkpoint_specified)
+		errx(1, "--checkpoint can't be used with --output jsonl -");
+	
 	if(blocksize<128)
 		errx(1, "blocksize is NaN or too small");
 	
+	if(entropymap_specified && (entropy_window<16 || entropy_window>blocksize))
+		errx(1, "entropy window is NaN or not between 16 and blocksize");
+	
+	if(entropymap_specified && entropy_region==0)
+		errx(1, "entropy region is NaN or 0");
+	
+	if(do_cluster && cluster_max_gap==0)
+		errx(1, "max gap for --cluster is NaN or 0");
+	
 	if(searchstring_specified && strlen(searchstring)<2)
 		errx(1, "string for option --string is too short");
 	
+	if(nb_shards && (scan_start!=0 || scan_end!=UINT_FAST32_MAX))
+		errx(1, "--shard can't be combined with --start or --end");
+	
+	if(scan_start>=scan_end)
+		errx(1, "--start must be smaller than --end");
+	
+	if(max_hits_specified && max_hits==0)
+		errx(1, "argument for --max-hits is NaN or 0");
+	
+	if(sample_specified && !(sample_rate>0 && sample_rate<=1))
+		errx(1, "rate for --sample is NaN or not in (0...1]");
+	
+	if(time_budget_specified && !(time_budget>0))
+		errx(1, "seconds for --time-budget is NaN or 0");
+	
+	bool random_order=(sample_specified || time_budget_specified);
+	
+	if(aligned_first && random_order)
+		errx(1, "--aligned-first can't be combined with --sample or --time-budget");
+	
+	//these need the offsets in increasing order
+	if((aligned_first || random_order) && (do_cluster || entropymap_specified || checkpoint_specified))
+		errx(1, "--aligned-first, --sample and --time-budget can't be combined with --cluster, --entropy-map or --checkpoint");
+	
+	if(baseline_specified!=baseline_results_specified)
+		errx(1, "--baseline and --baseline-results must be used together");
+	
+	if(baseline_specified && !output_specified)
+		errx(1, "--baseline needs --output jsonl, the results of the old dump are taken over as JSONL");
+	
+	//only the results of the filesystem search can be taken over and the offsets must be in increasing order, the cache doesn't know about the old dump
+	if(baseline_specified && (dont_do_search || searchstring_specified || stringsfile_specified || nb_regexes || entropymap_specified || do_cluster || strlen(extract_dir) || do_invalid_summary || checkpoint_specified || aligned_first || random_order || max_hits_specified || files_specified || cache_specified))
+		errx(1, "--baseline can't be combined with --nosearch, --string, --strings-file, --regex, --entropy-map, --cluster, --extract, --invalid-summary, --checkpoint, --aligned-first, --sample, --time-budget, --max-hits, --files or --cache");
+	
+	const bool transformed=(swap16 || swap32 || nb_chips);
+	const uint_fast32_t nb_views=(plain || !transformed)+swap16+swap32+nb_chips;
+	
+	if(plain && !transformed)
+		errx(1, "--plain is only useful together with --swap16, --swap32 or --deinterleave");
+	
+	if(nand_page_size && transformed)
+		errx(1, "--nand-layout can't be combined with --swap16, --swap32 or --deinterleave");
+	
+	//the old dump would need the same view
+	if(baseline_specified && (nand_page_size || transformed))
+		errx(1, "--baseline can't be combined with --nand-layout, --swap16, --swap32 or --deinterleave");
+	
+	//these keep state from one offset to the next or write files per hit
+	if(nb_views>1 && (do_cluster || entropymap_specified || strlen(extract_dir) || checkpoint_specified))
+		errx(1, "--cluster, --entropy-map, --extract and --checkpoint can only be used with a single view");
+	
+	if(resume && !checkpoint_specified)
+		errx(1, "--resume needs --checkpoint $name");
+	
+	//the state of these is not saved
+	if(checkpoint_specified && (do_cluster || entropymap_specified || do_invalid_summary))
+		errx(1, "--checkpoint can't be combined with --cluster, --entropy-map or --invalid-summary");
+	
+	if(files_specified)
+	{
+		batch_t batch;
+		batch_load(&batch, fileslist);
+		
+		if(mkdir(resultsdir, 0755) && errno!=EEXIST)
+			err(1, "can't create directory %s", resultsdir);
+		if(strlen(extract_dir) && mkdir(extract_dir, 0755) && errno!=EEXIST)
+			err(1, "can't create directory %s", extract_dir);
+		
+		decrypt_init(blocksize); //once for all workers
+		
+		batch_job=batch_run(&batch, nb_jobs);
+		if(batch_job<0)
+		{
+			batch_free(&batch);
+			user_decrypt_cleanup();
+			printf("\nall done - bye\n\n");
+			return 0;
+		}
+		
+		//this is a worker now, everything it makes goes to files named after its dump
+		batch_job_t const * const job=&batch.jobs[batch_job];
+		char resultfile[SZ_FILENAME_MAX+1];
+		
+		if(strlen(job->filename)>SZ_FILENAME_MAX || strlen(resultsdir)+strlen(job->name)+strlen("/.jsonl")>SZ_FILENAME_MAX)
+			errx(1, "filename \"%s\" is too long", job->filename);
+		
+		strcpy(filename, job->filename);
+		sprintf(resultfile, "%s/%s.txt", resultsdir, job->name);
+		if(output_specified)
+			sprintf(outputfile, "%s/%s.jsonl", resultsdir, job->name);
+		if(entropymap_specified)
+			sprintf(entropymapfile, "%s/%s.csv", resultsdir, job->name);
+		if(strlen(extract_dir))
+			snprintf(extract_dir+strlen(extract_dir), sizeof(extract_dir)-strlen(extract_dir), "/%s", job->name);
+		
+		if(freopen(resultfile, "w", stdout)==NULL)
+			err(1, "can't open %s for writing", resultfile);
+		
+		batch_free(&batch);
+	}
+	
 	FILE * inp=fopen(filename,"rb");
 	if(!inp)
 		err(1, "can't open \"%s\"", filename);
@@ -671,39 +1347,454 @@ int main(int argc, char * argv[])
 		err(1, "fread for \"%s\" failed", filename);
 	fclose(inp);
 	
-	user_decrypt_init(blocksize);
+	bool success=false;
+	
+	//the output for an output file named "-" goes to stdout and is recorded with everything else
+	char const * const cache_outputfile=(output_specified && strcmp(outputfile, "-"))?outputfile:NULL;
+	cache_t cache;
+	if(cache_specified)
+	{
+		cache_init(&cache, cachedir, data, fsize, cache_options_hash);
+		
+		if(cache_replay(&cache, cache_outputfile, &success))
+		{
+			cache_free(&cache);
+			free(data);
+			printf("\nall done - bye\n\n");
+			return ((batch_job>=0 || daemon_worker) && !success)?BATCH_EXIT_NOTHING_FOUND:0;
+		}
+		
+		cache_record_start(&cache);
+	}
+	
+	view_t views[NB_VIEWS_MAX];
+	uint_fast32_t ind_view=0, v;
+	size_t view_size_max=0;
+	if(plain || !transformed)
+		view_init(&views[ind_view++], data, fsize, nand_page_size, nand_oob_size);
+	if(swap16)
+		view_init_swap(&views[ind_view++], data, fsize, 2);
+	if(swap32)
+		view_init_swap(&views[ind_view++], data, fsize, 4);
+	for(v=0; v<nb_chips; v++)
+		view_init_chip(&views[ind_view++], data, fsize, nb_chips, chip_width, v);
+	for(v=0; v<nb_views; v++)
+	{
+		if(views[v].size>view_size_max)
+			view_size_max=views[v].size;
+	}
+	input_view=&views[0];
+	
+	if(nand_page_size)
+		printf("NAND layout with %lu+%lu bytes per page, scanning %lu bytes without spare area - offsets below are those of the file\n\n", nand_page_size, nand_oob_size, views[0].size);
+	
+	if(transformed)
+	{
+		printf("scanning %lu views in a single pass:", nb_views);
+		for(v=0; v<nb_views; v++)
+			printf(" %s", views[v].name[0]?views[v].name:"plain");
+		printf("\n\n");
+	}
+	
+	//every offset is the start of exactly one block, the data of the block may reach into the next part
+	uint_fast32_t nb_offsets=(view_size_max>=blocksize)?(view_size_max-blocksize+1):0;
+	if(nb_shards)
+	{
+		scan_start=(uint64_t)nb_offsets*shard_index/nb_shards;
+		scan_end=(uint64_t)nb_offsets*(shard_index+1)/nb_shards;
+	}
+	else if(scan_end>nb_offsets)
+		scan_end=nb_offsets;
+	
+	if((scan_start || scan_end<nb_offsets) && scan_start<scan_end)
+		printf("scanning offsets 0x%lx (%lu) up to 0x%lx (%lu)\n\n", raw_offset(scan_start), raw_offset(scan_start), raw_offset(scan_end-1), raw_offset(scan_end-1));
+	
+	baseline_t baseline;
+	if(baseline_specified)
+	{
+		baseline_init(&baseline, baselinefile, baselineresults, data, fsize, blocksize, scan_start, scan_end);
+		printf("%lu of %lu offsets are unchanged compared to \"%s\", %lu results taken from \"%s\"\n\n", baseline.nb_offsets_unchanged, (scan_end>scan_start)?(scan_end-scan_start):0, baselinefile, baseline.nb_records, baselineresults);
+	}
+	
+	//a plain ASCII --string is faster without the automaton
+	bool string_use_set=(encodings!=(1<<ENCODING_ASCII) || ignore_case);
+	
+	uint_fast32_t * string_reported=NULL;
+	stringset_t string_set;
+	if(searchstring_specified && string_use_set)
+	{
+		ac_init(&string_set.ac, ignore_case);
+		string_set.numbered=false;
+		string_set.match_entire_word=match_entire_word;
+		stringset_add(&string_set, (uint8_t*)searchstring, strlen(searchstring), searchstring, 0, encodings);
+		stringset_finish(&string_set, blocksize);
+	}
+	else if(searchstring_specified)
+	{
+		string_reported=calloc(blocksize, sizeof(uint_fast32_t));
+		if(string_reported==NULL)
+			err(1, "calloc for string_reported failed");
+	}
+	
+	stringset_t strings_set;
+	if(stringsfile_specified)
+	{
+		ac_init(&strings_set.ac, ignore_case);
+		strings_set.numbered=true;
+		strings_set.match_entire_word=false;
+		load_strings_file(&strings_set, stringsfile, encodings);
+		stringset_finish(&strings_set, blocksize);
+		printf("loaded %lu strings (%lu patterns with all encodings) from \"%s\"\n\n", strings_set.ac.patterns[strings_set.ac.nb_patterns-1].tag/NB_ENCODINGS+1, strings_set.ac.nb_patterns, stringsfile);
+	}
+	
+	regexdfa_t regexes[NB_REGEX_MAX];
+	uint_fast32_t * regex_reported=NULL;
+	if(nb_regexes)
+	{
+		uint_fast32_t i;
+		for(i=0; i<nb_regexes; i++)
+		{
+			regexdfa_compile(&regexes[i], regex_patterns[i]);
+			printf("regex #%lu \"%s\" compiled to %lu+%lu DFA states\n", i, regex_patterns[i], regexes[i].forward.nb_states, regexes[i].reverse.nb_states);
+		}
+		printf("\n");
+		
+		regex_reported=calloc(nb_regexes*blocksize, sizeof(uint_fast32_t));
+		if(regex_reported==NULL)
+			err(1, "calloc for regex_reported failed");
+	}
+	
+	entropy_t entropy;
+	entropymap_t entropymap;
+	uint8_t entropy_first_byte=0;
+	if(entropymap_specified)
+	{
+		entropy_init(&entropy, entropy_window);
+		entropymap_init(&entropymap, entropymapfile, entropy_region, entropy_window);
+	}
+	
+	clusterer_t clusterer;
+	if(do_cluster)
+		clusterer_init(&clusterer, NB_ENTRIES_MAGIC, cluster_max_gap, print_region, NULL);
+	
+	extractor_t extractor;
+	if(strlen(extract_dir))
+		extractor_init(&extractor, extract_dir, &views[0], blocksize, position_independent);
+	
+	invalid_summary_t invalid_summary;
+	if(do_invalid_summary)
+		invalid_summary_init(&invalid_summary, invalid_summary_nb_top);
+	
+	stats_t stats;
+	if(stats_specified)
+	{
+		stats_init(&stats);
+		scan_stats=&stats;
+	}
+	
+	checkpoint_t checkpoint;
+	uint_fast32_t startpos_first=scan_start;
+	long output_pos=-1;
+	time_t checkpoint_next_time=time(NULL)+CHECKPOINT_INTERVAL;
+	if(checkpoint_specified)
+	{
+		checkpoint_init(&checkpoint, checkpointfile, data, fsize, options_hash);
+		if(string_reported)
+			checkpoint_add_ring(&checkpoint, string_reported, blocksize);
+		if(searchstring_specified && string_use_set)
+			checkpoint_add_slot_ring(&checkpoint, string_set.reported, blocksize);
+		if(stringsfile_specified)
+			checkpoint_add_slot_ring(&checkpoint, strings_set.reported, blocksize);
+		if(nb_regexes)
+			checkpoint_add_ring(&checkpoint, regex_reported, nb_regexes*blocksize);
+		
+		if(resume)
+		{
+			startpos_first=checkpoint_resume(&checkpoint, &output_pos, &success);
+			printf("resuming from checkpoint \"%s\" at 0x%lx (%lu)\n\n", checkpointfile, startpos_first, startpos_first);
+		}
+		
+		signal(SIGINT, handle_interrupt);
+		signal(SIGTERM, handle_interrupt);
+	}
+	
+	jsonl_t jsonl;
+	if(output_specified)
+	{
+		if(resume)
+			jsonl_reopen(&jsonl, outputfile, output_pos);
+		else
+			jsonl_open(&jsonl, outputfile);
+		output_jsonl=&jsonl;
+	}
+	
+	decrypt_init(blocksize); //nothing to do in a worker of --files or --daemon
 	
 	uint8_t * data_current_try=malloc(blocksize*sizeof(uint8_t));
 	if(data_current_try==NULL)
 		err(1, "malloc for data_current_try failed");
 	
+	report_t report={ .blocksize=blocksize, .show_invalid=show_invalid, .verify=verify, .match_entire_word=match_entire_word, .clusterer=do_cluster?&clusterer:NULL, .extractor=strlen(extract_dir)?&extractor:NULL, .invalid_summary=do_invalid_summary?&invalid_summary:NULL, .string_reported=string_reported, .success=&success };
+	fsfuzz_t engine;
+	fsfuzz_init(&engine, blocksize);
+	engine.verify=verify;
+	engine.report_invalid=(show_invalid || do_invalid_summary);
+	engine.searchstring=searchstring;
+	engine.match_entire_word=match_entire_word;
+	engine.stats=scan_stats;
+	engine.on_hit=report_hit;
+	engine.hit_userdata=&report;
+	
 	printf("starting search with blocksize %lu...\n\n", blocksize);
 	
+	if(!dont_do_search && engine.blocksize_too_small)
+		printf("warning: blocksize is to small for at least one test\n\n");
+	
 	uint_fast32_t startpos;
-	bool success=false;
+	uint_fast32_t nb_hits=0;
+	uint64_t nb_scanned=0;
+	uint_fast8_t pass_announced=NB_SCAN_PASSES;
+	uint_fast32_t next_contiguous=UINT_FAST32_MAX; //startpos+1 of the last block
+	
+	scanorder_t order;
+	if(aligned_first)
+		scanorder_init(&order, ORDER_ALIGNED_FIRST, startpos_first, scan_end, 0, 0);
+	else if(random_order)
+		scanorder_init(&order, ORDER_RANDOM, startpos_first, scan_end, seed, (scan_end>startpos_first)?(uint64_t)ceil(sample_rate*(scan_end-startpos_first)):0);
+	else
+		scanorder_init(&order, ORDER_SEQUENTIAL, startpos_first, scan_end, 0, 0);
+	
+	reported_set_t unordered_reported;
+	if(aligned_first || random_order || nb_views>1)
+	{
+		reported_set_init(&unordered_reported, NB_REPORTED_SET_INITIAL);
+		reported_set=&unordered_reported;
+	}
 	
-	for(startpos=0; (startpos+blocksize)<fsize; startpos++)
+	struct timespec scan_start_time;
+	clock_gettime(CLOCK_MONOTONIC, &scan_start_time);
+	
+	for(startpos=scanorder_next(&order); startpos<scan_end && (startpos+blocksize)<=view_size_max; startpos=scanorder_next(&order))
 	{
-		memcpy(data_current_try, &data[startpos], blocksize);
+		bool only_new_bytes=(position_independent && startpos==next_contiguous && nb_views==1); //the state carried over is that of the last view
+		next_contiguous=startpos+1;
+		
+		if(aligned_first && order.pass!=pass_announced)
+		{
+			if(scan_alignments[order.pass]>1)
+				printf("scanning offsets aligned to %lu bytes...\n", scan_alignments[order.pass]);
+			else
+				printf("scanning all other offsets...\n");
+			pass_announced=order.pass;
+		}
+		
+		if(baseline_specified)
+		{
+			baseline_write_results(&baseline, output_jsonl, startpos);
+			if(baseline_block_unchanged(&baseline, startpos))
+				continue;
+		}
+		
+		if(time_budget_specified && (nb_scanned%SAMPLE_CLOCK_INTERVAL)==0 && get_elapsed_ns(&scan_start_time)>=time_budget*1e9)
+			break;
+		nb_scanned++;
+		
+		if(checkpoint_specified && (interrupted || ((startpos%CHECKPOINT_CHECK_INTERVAL)==0 && time(NULL)>=checkpoint_next_time)))
+		{
+			fflush(stdout);
+			checkpoint_write(&checkpoint, startpos, output_jsonl?jsonl_tell(output_jsonl):-1, success);
+			if(interrupted)
+				break;
+			checkpoint_next_time=time(NULL)+CHECKPOINT_INTERVAL;
+		}
+		
+		if(scan_stats)
+			stats_offset_start(scan_stats);
+		
+		for(v=0; v<nb_views; v++)
+		{
+			if(startpos+blocksize>views[v].size)
+				continue;
+			
+			input_view=&views[v];
+			if(output_jsonl)
+				output_jsonl->view=views[v].name[0]?views[v].name:NULL;
+			
+			view_read(&views[v], data_current_try, startpos, blocksize);
+		
+			if(scan_stats)
+				stats_phase_end(scan_stats, PHASE_MEMCPY);
+		
+			user_decrypt_block(data_current_try, blocksize);
+		
+			if(scan_stats)
+				stats_phase_end(scan_stats, PHASE_DECRYPT);
+		
+			if(entropymap_specified)
+			{
+				uint_fast32_t i;
+			
+				if(only_new_bytes) //slide the window by one byte
+				{
+					entropy_remove(&entropy, entropy_first_byte);
+					entropy_add(&entropy, data_current_try[entropy_window-1]);
+				}
+				else
+				{
+					entropy_clear(&entropy);
+					for(i=0; i<entropy_window; i++)
+						entropy_add(&entropy, data_current_try[i]);
+				}
+				entropy_first_byte=data_current_try[0];
+			
+				double h=entropy_get(&entropy);
+				if(entropymap_update(&entropymap, raw_offset(startpos), h))
+				{
+					if(output_jsonl)
+						jsonl_write_entropy_drop(output_jsonl, raw_offset(startpos), h, entropymap.average);
+					else
+						printf("0x%lx (%lu)%s: entropy drops to %.2f bits/byte (average %.2f)\n", raw_offset(startpos), raw_offset(startpos), view_label(), h, entropymap.average);
+				}
+			
+				if(scan_stats)
+					stats_phase_end(scan_stats, PHASE_ENTROPY);
+			}
+		
+			if(searchstring_specified && string_use_set)
+				do_search_strings(data_current_try, startpos, blocksize, &string_set, only_new_bytes, &success);
+			else if(searchstring_specified)
+				fsfuzz_search_string(&engine, data_current_try, startpos, only_new_bytes, NULL); //duplicates are dropped by report_hit()
+		
+			if(stringsfile_specified)
+				do_search_strings(data_current_try, startpos, blocksize, &strings_set, only_new_bytes, &success);
+		
+			if(scan_stats && (searchstring_specified || stringsfile_specified))
+				stats_phase_end(scan_stats, PHASE_STRINGS);
+		
+			if(nb_regexes)
+			{
+				do_search_regex(data_current_try, startpos, blocksize, regexes, nb_regexes, startpos+blocksize==views[v].size, regex_reported, &success);
+				if(scan_stats)
+					stats_phase_end(scan_stats, PHASE_REGEX);
+			}
 		
-		user_decrypt_block(data_current_try, blocksize);
+			if(do_cluster)
+				clusterer_expire(&clusterer, raw_offset(startpos));
 		
-		if(searchstring_specified)
-			do_search_string(data_current_try, startpos, blocksize, searchstring, match_entire_word, &success);
+			if(!dont_do_search)
+				nb_hits+=fsfuzz_search_magic(&engine, data_current_try, startpos);
 		
-		if(!dont_do_search)
-			search_magic(data_current_try, startpos, blocksize, show_invalid, &success);
+			if(scan_stats)
+				stats_phase_end(scan_stats, PHASE_MAGIC);
+		}
+		
+		if(max_hits && nb_hits>=max_hits)
+		{
+			printf("\nstopping after %lu filesystems found (--max-hits)\n", nb_hits);
+			break;
+		}
+	}
+	
+	if(random_order && nb_scanned)
+	{
+		const double fraction=(double)nb_scanned/(scan_end-startpos_first);
+		const double seconds=get_elapsed_ns(&scan_start_time)/1e9;
+		printf("\nsampled %lu of %lu offsets (%.3f%%) in %.1f s (seed %lu): %lu filesystems found\n", nb_scanned, scan_end-startpos_first, 100*fraction, seconds, seed, nb_hits);
+		printf("estimate for a full scan: %.0f filesystems in %.0f s\n", nb_hits/fraction, seconds/fraction);
+		if(nb_hits==0)
+			printf("no hit in the sample: a full scan would find fewer than %.0f with 95%% confidence (rule of three)\n", 3/fraction);
 	}
 	
-	if(!success)
+	if(baseline_specified)
+	{
+		baseline_write_results(&baseline, output_jsonl, scan_end);
+		if(baseline.success)
+			success=true;
+		baseline_free(&baseline);
+	}
+	
+	if(do_cluster)
+		clusterer_finish(&clusterer);
+	
+	if(strlen(extract_dir))
+		extractor_free(&extractor);
+	
+	if(do_invalid_summary)
+	{
+		invalid_summary_print(&invalid_summary);
+		invalid_summary_free(&invalid_summary);
+	}
+	
+	if(output_specified)
+	{
+		jsonl_close(&jsonl);
+		output_jsonl=NULL;
+	}
+	
+	if(stats_specified)
+	{
+		stats_print(&stats, blocksize);
+		scan_stats=NULL;
+	}
+	
+	if(interrupted)
+		printf("interrupted at 0x%lx (%lu), progress saved to \"%s\" - run the same command plus --resume to continue\n", startpos, startpos, checkpointfile);
+	else if(!success)
 		printf("nothing found - you may want to try with bigger blocksize\n");
 	
+	if(checkpoint_specified)
+	{
+		if(!interrupted)
+			unlink(checkpointfile); //scan complete, nothing to resume
+		checkpoint_free(&checkpoint);
+	}
+	
+	if(cache_specified)
+	{
+		cache_record_finish(&cache, cache_outputfile, success);
+		cache_free(&cache);
+	}
+	
+	fsfuzz_free(&engine);
+	input_view=NULL;
+	for(v=0; v<nb_views; v++)
+		view_free(&views[v]);
 	free(data);
 	free(data_current_try);
 	
+	if(aligned_first || random_order || nb_views>1)
+	{
+		free(unordered_reported.entries);
+		reported_set=NULL;
+	}
+	
+	if(entropymap_specified)
+	{
+		entropymap_finish(&entropymap);
+		entropy_free(&entropy);
+	}
+	
+	free(string_reported);
+	if(searchstring_specified && string_use_set)
+		stringset_free(&string_set, blocksize);
+	
+	if(nb_regexes)
+	{
+		uint_fast32_t i;
+		for(i=0; i<nb_regexes; i++)
+			regexdfa_free(&regexes[i]);
+		free(regex_reported);
+	}
+	
+	if(stringsfile_specified)
+		stringset_free(&strings_set, blocksize);
+	
 	user_decrypt_cleanup();
 	
 	printf("\nall done - bye\n\n");
 	
+	if((batch_job>=0 || daemon_worker) && !success)
+		return BATCH_EXIT_NOTHING_FOUND;
+	
 	return 0;
 }
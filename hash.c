@@ -0,0 +1,116 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hash.h"
+
+/*
+This file is part of fsfuzz.
+
+XXH64 by Yann Collet (see https://github.com/Cyan4973/xxHash for the specification), written from the spec. It is used to recognize input files and option sets, so it needs to be fast on whole dumps (several GB/s) but not cryptographically strong.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define PRIME64_1 0x9E3779B185EBCA87ULL
+#define PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define PRIME64_3 0x165667B19E3779F9ULL
+#define PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define PRIME64_5 0x27D4EB2F165667C5ULL
+
+static uint64_t rotl64(const uint64_t x, const uint_fast8_t r)
+{
+	return (x<<r)|(x>>(64-r));
+}
+
+//little endian loads regardless of the host
+static uint64_t read_le64(uint8_t const * const p)
+{
+	return (uint64_t)p[0]|((uint64_t)p[1]<<8)|((uint64_t)p[2]<<16)|((uint64_t)p[3]<<24)|((uint64_t)p[4]<<32)|((uint64_t)p[5]<<40)|((uint64_t)p[6]<<48)|((uint64_t)p[7]<<56);
+}
+
+static uint32_t read_le32(uint8_t const * const p)
+{
+	return p[0]|(p[1]<<8)|(p[2]<<16)|((uint32_t)p[3]<<24);
+}
+
+static uint64_t round64(uint64_t acc, const uint64_t input)
+{
+	acc+=input*PRIME64_2;
+	acc=rotl64(acc, 31);
+	return acc*PRIME64_1;
+}
+
+static uint64_t merge_round64(uint64_t acc, const uint64_t val)
+{
+	acc^=round64(0, val);
+	return acc*PRIME64_1+PRIME64_4;
+}
+
+uint64_t xxh64(void const * const data, const size_t len, const uint64_t seed)
+{
+	uint8_t const * p=data;
+	uint8_t const * const end=p+len;
+	uint64_t h;
+	
+	if(len>=32)
+	{
+		uint8_t const * const limit=end-32;
+		uint64_t v1=seed+PRIME64_1+PRIME64_2;
+		uint64_t v2=seed+PRIME64_2;
+		uint64_t v3=seed;
+		uint64_t v4=seed-PRIME64_1;
+		
+		do
+		{
+			v1=round64(v1, read_le64(p));
+			v2=round64(v2, read_le64(p+8));
+			v3=round64(v3, read_le64(p+16));
+			v4=round64(v4, read_le64(p+24));
+			p+=32;
+		} while(p<=limit);
+		
+		h=rotl64(v1, 1)+rotl64(v2, 7)+rotl64(v3, 12)+rotl64(v4, 18);
+		h=merge_round64(h, v1);
+		h=merge_round64(h, v2);
+		h=merge_round64(h, v3);
+		h=merge_round64(h, v4);
+	}
+	else
+		h=seed+PRIME64_5;
+	
+	h+=len;
+	
+	while(p+8<=end)
+	{
+		h^=round64(0, read_le64(p));
+		h=rotl64(h, 27)*PRIME64_1+PRIME64_4;
+		p+=8;
+	}
+	
+	if(p+4<=end)
+	{
+		h^=(uint64_t)read_le32(p)*PRIME64_1;
+		h=rotl64(h, 23)*PRIME64_2+PRIME64_3;
+		p+=4;
+	}
+	
+	while(p<end)
+	{
+		h^=(*p)*PRIME64_5;
+		h=rotl64(h, 11)*PRIME64_1;
+		p++;
+	}
+	
+	h^=h>>33;
+	h*=PRIME64_2;
+	h^=h>>29;
+	h*=PRIME64_3;
+	h^=h>>32;
+	
+	return h;
+}
@@ -0,0 +1,20 @@
+#ifndef __HASH_H__
+#define __HASH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+//XXH64, same results as the reference implementation
+uint64_t xxh64(void const * const data, const size_t len, const uint64_t seed);
+
+#endif
@@ -0,0 +1,128 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "invalidsummary.h"
+#include "magicdata.h"
+
+/*
+This file is part of fsfuzz.
+
+Counts invalid results per magic entry and per test that made them invalid instead of printing each of them like --show-invalid does.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define SZ_OFFSET_STR 48
+
+//the offset as written in the magic-database
+static void format_offset(test_t const * const test, char * const str)
+{
+	char const * const relative=test->offset_relative?"&":"";
+	
+	if(test->offset_indirect)
+	{
+		const char letter=(test->indirect_type==DATA_UINT8)?'b':(test->indirect_type==DATA_UINT16)?'s':(test->indirect_type==DATA_UINT32)?'l':'q';
+		const int n=sprintf(str, "(%s0x%lx.%c", relative, test->offset, (test->indirect_endian==ENDIAN_BE)?letter-'a'+'A':letter);
+		if(test->indirect_adjust)
+			sprintf(str+n, "%c0x%lx)", (test->indirect_adjust<0)?'-':'+', (test->indirect_adjust<0)?-test->indirect_adjust:test->indirect_adjust);
+		else
+			sprintf(str+n, ")");
+	}
+	else
+		sprintf(str, "%s0x%lx", relative, test->offset);
+}
+
+void invalid_summary_init(invalid_summary_t * const summary, const uint_fast32_t nb_top)
+{
+	memset(summary, 0, sizeof(invalid_summary_t));
+	
+	summary->nb_top=nb_top;
+	if(nb_top)
+	{
+		summary->top=malloc(NB_ENTRIES_MAGIC*nb_top*sizeof(invalid_hit_t));
+		if(summary->top==NULL)
+			err(1, "malloc for invalid summary failed");
+	}
+}
+
+void invalid_summary_add(invalid_summary_t * const summary, const uint_fast32_t ind_magic, const uint_fast8_t ind_test, const uint_fast32_t offset)
+{
+	invalid_hit_t * const top=&summary->top[ind_magic*summary->nb_top];
+	uint_fast32_t * const nb_in_top=&summary->nb_in_top[ind_magic];
+	uint_fast32_t i;
+	
+	summary->count[ind_magic]++;
+	summary->count_test[ind_magic][ind_test]++;
+	
+	if(summary->nb_top==0)
+		return;
+	
+	//sorted by ind_test descending, offsets come in ascending order so on equal ind_test the earlier hit stays in front
+	if((*nb_in_top)==summary->nb_top)
+	{
+		if(top[summary->nb_top-1].ind_test>=ind_test)
+			return;
+		(*nb_in_top)--;
+	}
+	
+	for(i=(*nb_in_top); i>0 && top[i-1].ind_test<ind_test; i--)
+		top[i]=top[i-1];
+	top[i].offset=offset;
+	top[i].ind_test=ind_test;
+	(*nb_in_top)++;
+}
+
+void invalid_summary_print(invalid_summary_t const * const summary)
+{
+	uint_fast32_t ind_magic, i;
+	uint64_t total=0;
+	
+	for(ind_magic=0; ind_magic<NB_ENTRIES_MAGIC; ind_magic++)
+		total+=summary->count[ind_magic];
+	
+	printf("\ninvalid results: %lu\n", total);
+	
+	for(ind_magic=0; ind_magic<NB_ENTRIES_MAGIC; ind_magic++)
+	{
+		if(summary->count[ind_magic]==0)
+			continue;
+		
+		printf("\n#%lu %s: %lu\n", ind_magic, magic[ind_magic].tests[0].message, summary->count[ind_magic]);
+		
+		for(i=0; i<magic[ind_magic].nb_tests; i++)
+		{
+			test_t const * const test=&magic[ind_magic].tests[i];
+			if(summary->count_test[ind_magic][i])
+			{
+				char offset_str[SZ_OFFSET_STR];
+				format_offset(test, offset_str);
+				printf("\ttest %2lu (level %u, offset %s) %10lu  %s\n", i, test->level, offset_str, summary->count_test[ind_magic][i], test->message);
+			}
+		}
+		
+		if(summary->nb_in_top[ind_magic])
+		{
+			printf("\tfurthest:");
+			for(i=0; i<summary->nb_in_top[ind_magic]; i++)
+			{
+				invalid_hit_t const * const hit=&summary->top[ind_magic*summary->nb_top+i];
+				printf(" 0x%lx (test %u)", hit->offset, hit->ind_test);
+			}
+			printf("\n");
+		}
+	}
+}
+
+void invalid_summary_free(invalid_summary_t * const summary)
+{
+	free(summary->top);
+	summary->top=NULL;
+}
@@ -0,0 +1,39 @@
+#ifndef __INVALIDSUMMARY_H__
+#define __INVALIDSUMMARY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "magicdata_constants.h"
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+typedef struct
+{
+	uint_fast32_t offset;
+	uint_fast8_t ind_test; //the test that made the hit invalid, a higher index means more tests passed before
+} invalid_hit_t;
+
+typedef struct
+{
+	uint64_t count[NB_ENTRIES_MAGIC];
+	uint64_t count_test[NB_ENTRIES_MAGIC][NB_TESTS_MAX];
+	uint_fast32_t nb_top; //offsets kept per entry
+	invalid_hit_t * top; //nb_top per entry, the hits that got furthest
+	uint_fast32_t nb_in_top[NB_ENTRIES_MAGIC];
+} invalid_summary_t;
+
+void invalid_summary_init(invalid_summary_t * const summary, const uint_fast32_t nb_top);
+void invalid_summary_add(invalid_summary_t * const summary, const uint_fast32_t ind_magic, const uint_fast8_t ind_test, const uint_fast32_t offset);
+void invalid_summary_print(invalid_summary_t const * const summary);
+void invalid_summary_free(invalid_summary_t * const summary);
+
+#endif
@@ -0,0 +1,194 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <err.h>
+
+#include "jsonl.h"
+
+/*
+This file is part of fsfuzz.
+
+JSON Lines output, one record per hit. Everything goes through a big stdio buffer so even millions of records (--show-invalid) don't slow down the scan.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+static void jsonl_set_buffer(jsonl_t * const j)
+{
+	j->buffer=malloc(JSONL_BUFFER_SIZE);
+	if(j->buffer==NULL)
+		err(1, "malloc for JSONL buffer failed");
+	
+	if(setvbuf(j->f, j->buffer, _IOFBF, JSONL_BUFFER_SIZE))
+		errx(1, "setvbuf for JSONL output failed");
+}
+
+void jsonl_open(jsonl_t * const j, char const * const filename)
+{
+	j->view=NULL;
+	
+	if(!strcmp(filename, "-"))
+	{
+		//for --daemon, records are sent as soon as they are complete
+		j->f=fdopen(dup(STDOUT_FILENO), "w");
+		if(j->f==NULL)
+			err(1, "can't write JSONL to stdout");
+		
+		j->buffer=NULL;
+		if(setvbuf(j->f, NULL, _IOLBF, 0))
+			errx(1, "setvbuf for JSONL output failed");
+		
+		fflush(stdout); //keep what was printed before in front
+		return;
+	}
+	
+	j->f=fopen(filename, "w");
+	if(j->f==NULL)
+		err(1, "can't open %s for writing", filename);
+	
+	jsonl_set_buffer(j);
+}
+
+void jsonl_reopen(jsonl_t * const j, char const * const filename, const long pos)
+{
+	j->view=NULL;
+	
+	j->f=fopen(filename, "r+");
+	if(j->f==NULL)
+		err(1, "can't open %s for appending", filename);
+	
+	jsonl_set_buffer(j); //must be done before any other operation on the stream
+	
+	//records written after the checkpoint will be written again
+	if(ftruncate(fileno(j->f), pos))
+		err(1, "truncating %s failed", filename);
+	if(fseek(j->f, 0, SEEK_END))
+		err(1, "fseek to end of %s failed", filename);
+}
+
+long jsonl_tell(jsonl_t * const j)
+{
+	if(fflush(j->f))
+		err(1, "writing JSONL output failed");
+	
+	return ftell(j->f);
+}
+
+static void write_string(FILE * const f, char const * const str, const size_t len)
+{
+	size_t i;
+	
+	fputc('"', f);
+	for(i=0; i<len; i++)
+	{
+		unsigned char c=str[i];
+		
+		if(c=='"' || c=='\\')
+		{
+			fputc('\\', f);
+			fputc(c, f);
+		}
+		else if(c=='\n')
+			fputs("\\n", f);
+		else if(c<0x20 || c>=0x7f) //messages are not necessarily valid UTF-8
+			fprintf(f, "\\u%04x", c);
+		else
+			fputc(c, f);
+	}
+	fputc('"', f);
+}
+
+static void write_view(jsonl_t const * const j)
+{
+	if(j->view)
+	{
+		fputs("\"view\":", j->f);
+		write_string(j->f, j->view, strlen(j->view));
+		fputc(',', j->f);
+	}
+}
+
+void jsonl_write_magic(jsonl_t * const j, const uint_fast32_t offset, const uint_fast32_t ind_magic, char const * const name, const bool valid, char const * const verify_status, const uint64_t fs_size, char const * const message, test_value_t const * const values, const uint_fast32_t nb_values)
+{
+	uint_fast32_t i;
+	size_t msg_start=strspn(message, " ");
+	size_t msg_end=strlen(message);
+	
+	while(msg_end>msg_start && isspace((unsigned char)message[msg_end-1]))
+		msg_end--; //the message is built for printing, leading space and newline of dates aren't interesting here
+	
+	fprintf(j->f, "{\"type\":\"magic\",\"offset\":%lu,", offset);
+	write_view(j);
+	fprintf(j->f, "\"magic_id\":%lu,\"name\":", ind_magic);
+	write_string(j->f, name, strlen(name));
+	fprintf(j->f, ",\"valid\":%s", valid?"true":"false");
+	if(verify_status)
+		fprintf(j->f, ",\"verify\":\"%s\"", verify_status);
+	if(fs_size)
+		fprintf(j->f, ",\"size\":%lu", fs_size);
+	fputs(",\"message\":", j->f);
+	write_string(j->f, message+msg_start, msg_end-msg_start);
+	
+	fputs(",\"values\":[", j->f);
+	for(i=0; i<nb_values; i++)
+	{
+		fprintf(j->f, "%s{\"level\":%u,\"offset\":%lu,\"value\":", i?",":"", values[i].level, values[i].offset);
+		switch(values[i].type)
+		{
+			case VALUE_NONE: fputs("null", j->f); break;
+			case VALUE_SIGNED: fprintf(j->f, "%ld", values[i].value_signed); break;
+			case VALUE_UNSIGNED: fprintf(j->f, "%lu", values[i].value_unsigned); break;
+			case VALUE_DATE: write_string(j->f, values[i].str, strlen(values[i].str)); break;
+		}
+		fputc('}', j->f);
+	}
+	fputs("]}\n", j->f);
+}
+
+void jsonl_write_line(jsonl_t * const j, char const * const line)
+{
+	fputs(line, j->f);
+	fputc('\n', j->f);
+}
+
+void jsonl_write_match(jsonl_t * const j, const uint_fast32_t offset, char const * const label, char const * const match)
+{
+	fprintf(j->f, "{\"type\":\"match\",\"offset\":%lu,", offset);
+	write_view(j);
+	fputs("\"label\":", j->f);
+	write_string(j->f, label, strlen(label));
+	fputs(",\"match\":", j->f);
+	write_string(j->f, match, strlen(match));
+	fputs("}\n", j->f);
+}
+
+void jsonl_write_entropy_drop(jsonl_t * const j, const uint_fast32_t offset, const double entropy, const double average)
+{
+	fprintf(j->f, "{\"type\":\"entropy_drop\",\"offset\":%lu,", offset);
+	write_view(j);
+	fprintf(j->f, "\"entropy\":%.3f,\"average\":%.3f}\n", entropy, average);
+}
+
+void jsonl_write_region(jsonl_t * const j, const uint_fast32_t start, const uint_fast32_t last, const uint_fast32_t count, const uint_fast32_t stride, const uint_fast32_t max_spacing, char const * const family, const size_t family_len)
+{
+	fprintf(j->f, "{\"type\":\"region\",\"offset\":%lu,", start);
+	write_view(j);
+	fprintf(j->f, "\"last\":%lu,\"count\":%lu,\"stride\":%lu,\"max_spacing\":%lu,\"family\":", last, count, stride, max_spacing);
+	write_string(j->f, family, family_len);
+	fputs("}\n", j->f);
+}
+
+void jsonl_close(jsonl_t * const j)
+{
+	if(fclose(j->f))
+		err(1, "writing JSONL output failed");
+	free(j->buffer);
+}
@@ -0,0 +1,67 @@
+#ifndef __JSONL_H__
+#define __JSONL_H__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define JSONL_BUFFER_SIZE (4<<20)
+#define SZ_VALUE_STR 64
+
+typedef enum
+{
+	VALUE_NONE, //string tests, the message says it all
+	VALUE_SIGNED,
+	VALUE_UNSIGNED,
+	VALUE_DATE
+} value_type_t;
+
+//what a single test of a magic entry read from the block
+typedef struct
+{
+	uint_fast8_t level;
+	uint64_t offset; //relative to the hit
+	uint64_t end; //first byte after the data that was read, relative offsets ("&n") of the child tests start here
+	value_type_t type;
+	union
+	{
+		int64_t value_signed;
+		uint64_t value_unsigned;
+	};
+	char str[SZ_VALUE_STR]; //for VALUE_DATE
+} test_value_t;
+
+typedef struct
+{
+	FILE * f;
+	char * buffer;
+	char const * view; //name of the view the results come from (--swap16, ...), NULL for the file as it is
+} jsonl_t;
+
+//filename "-" is stdout
+void jsonl_open(jsonl_t * const j, char const * const filename);
+//for --resume: keep the first pos bytes of an existing output and append to them
+void jsonl_reopen(jsonl_t * const j, char const * const filename, const long pos);
+//size of the output so far, everything buffered is written first
+long jsonl_tell(jsonl_t * const j);
+//verify_status is NULL if --verify wasn't given
+void jsonl_write_magic(jsonl_t * const j, const uint_fast32_t offset, const uint_fast32_t ind_magic, char const * const name, const bool valid, char const * const verify_status, const uint64_t fs_size, char const * const message, test_value_t const * const values, const uint_fast32_t nb_values);
+//a complete record, for example from an earlier run (--baseline), without newline
+void jsonl_write_line(jsonl_t * const j, char const * const line);
+void jsonl_write_match(jsonl_t * const j, const uint_fast32_t offset, char const * const label, char const * const match);
+void jsonl_write_entropy_drop(jsonl_t * const j, const uint_fast32_t offset, const double entropy, const double average);
+//stride is 0 if the spacing was irregular, family is not 0-terminated
+void jsonl_write_region(jsonl_t * const j, const uint_fast32_t start, const uint_fast32_t last, const uint_fast32_t count, const uint_fast32_t stride, const uint_fast32_t max_spacing, char const * const family, const size_t family_len);
+void jsonl_close(jsonl_t * const j);
+
+#endif
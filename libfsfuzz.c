@@ -0,0 +1,786 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <err.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "libfsfuzz.h"
+
+/*
+This file is part of fsfuzz.
+
+The scanner itself, without any command line or output: the matcher for the magic-database and the search for a single string in a decrypted block, plus a simple loop over all offsets of a buffer or file. Everything it needs is in an fsfuzz_t and hits are given to a callback, so it can be used from other programs and with one fsfuzz_t per thread from several threads at once (as long as the decrypt-callback allows it).
+
+fsfuzz.c is the command line tool on top of this. It has its own loop over the offsets because of everything it does in between (entropy, regex, checkpoints, ...).
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define SZ_TESTSTRING_PRINT_MAX 64
+#define SZ_DATE_STR 30 //for test_convert_date(), man-page says >=26 -> should be fine
+
+static uint64_t helper_get_value_unsigned(uint8_t const * const data, const uint_fast8_t nb_bytes, const endian_t endian)
+{
+	uint64_t ret=0;
+	uint_fast8_t i;
+	
+	if(endian==ENDIAN_LE)
+	{
+		for(i=0; i<nb_bytes; i++)
+			ret|=((uint64_t)data[i])<<(8*i);
+	}
+	else if(endian==ENDIAN_BE)
+	{
+		for(i=0; i<nb_bytes; i++)
+			ret|=((uint64_t)data[i])<<(8*(nb_bytes-i-1));		
+	}
+	else if(endian==ENDIAN_UNDEF && nb_bytes==1)
+		ret=(uint64_t)data[0];
+	else
+		errx(1, "helper_get_value_unsigned: undef endian for >1 byte requested");
+	
+	return ret;
+}	
+
+static uint64_t get_value_unsigned(uint8_t const * const data, const datatype_t type, const endian_t endian)
+{
+	uint64_t ret=0;
+	
+	switch(type)
+	{
+		case DATA_STRING:
+		case DATA_INT8:
+		case DATA_INT16:
+		case DATA_INT32:
+		case DATA_INT64:
+			errx(1, "get_value_unsigned: requested signed or string");
+			break;
+		
+		case DATA_DATE:
+		case DATA_UDATE:
+			errx(1, "get_value_unsigned: DATA_[U]DATE unimpl, call helper directly");
+			break;
+		
+		case DATA_UINT8:
+			ret=helper_get_value_unsigned(data, 1, endian);
+			break;
+		
+		case DATA_UINT16:
+			ret=helper_get_value_unsigned(data, 2, endian);
+			break;
+		
+		case DATA_UINT32:
+			ret=helper_get_value_unsigned(data, 4, endian);
+			break;
+		
+		case DATA_UINT64:
+			ret=helper_get_value_unsigned(data, 8, endian);
+			break;
+	}
+	
+	return ret;
+}
+
+static int64_t helper_get_value_signed(uint8_t const * const data, const uint_fast8_t nb_bytes, const endian_t endian)
+{
+	uint64_t u64=0;
+	int64_t ret;
+	uint_fast8_t i;
+	
+	if(endian==ENDIAN_LE)
+	{
+		for(i=0; i<nb_bytes; i++)
+			u64|=((uint64_t)data[i])<<(8*i);
+	}
+	else if(endian==ENDIAN_BE)
+	{
+		for(i=0; i<nb_bytes; i++)
+			u64|=((uint64_t)data[i])<<(8*(nb_bytes-i-1));		
+	}
+	else if(endian==ENDIAN_UNDEF && nb_bytes==1)
+		ret=(int64_t)data[0];
+	else
+		errx(1, "helper_get_value_signed: undef endian for >1 byte requested");
+	
+	if(u64&(1<<(8*nb_bytes-1)))
+		ret=-((u64-1)^((1ULL<<(8*nb_bytes))-1));
+	else
+		ret=u64;
+	
+	return ret;
+}	
+
+static int64_t get_value_signed(uint8_t const * const data, const datatype_t type, const endian_t endian)
+{
+	int64_t ret=0;
+	
+	switch(type)
+	{
+		case DATA_STRING:
+		case DATA_UINT8:
+		case DATA_UINT16:
+		case DATA_UINT32:
+		case DATA_UINT64:
+			errx(1, "get_value_signed: requested unsigned or string");
+			break;
+		
+		case DATA_DATE:
+		case DATA_UDATE:
+			errx(1, "get_value_signed: DATA_[U]DATE unimpl, call helper directly");
+			break;
+		
+		case DATA_INT8:
+			ret=helper_get_value_signed(data, 1, endian);
+			break;
+		
+		case DATA_INT16:
+			ret=helper_get_value_signed(data, 2, endian);
+			break;
+		
+		case DATA_INT32:
+			ret=helper_get_value_signed(data, 4, endian);
+			break;
+		
+		case DATA_INT64:
+			ret=helper_get_value_signed(data, 8, endian);
+			break;
+	}
+	
+	return ret;
+}
+
+void fsfuzz_mask_unprintable(char * const str, ssize_t len)
+{
+	len--; //don't touch terminating '\0'!
+	
+	while(len>=0)
+	{
+		if(str[len]<0x20 || str[len]>0x7E)
+			str[len]='?';
+		len--;
+	}
+}
+
+static void test_make_message(uint8_t const * const data, const uint_fast32_t blocksize, const uint64_t offset, const int64_t val_print, char const * const date_print, test_t const * const test, char * const message)
+{
+	char msg_buf[100];
+	char str_buf[SZ_TESTSTRING_PRINT_MAX+1];
+	
+	if(!test->flag_no_space)
+		strcat(message, " ");
+	if(test->message_has_argument)
+	{
+		if(test->data_type==DATA_STRING)
+		{
+			//the string in the block is not necessarily terminated
+			size_t len=0;
+			while(len<SZ_TESTSTRING_PRINT_MAX && offset+len<blocksize && data[offset+len])
+			{
+				str_buf[len]=data[offset+len];
+				len++;
+			}
+			str_buf[len]='\0';
+			fsfuzz_mask_unprintable(str_buf, len);
+			snprintf(msg_buf, sizeof(msg_buf), test->message, str_buf);
+		}
+		else if(test->data_type==DATA_DATE || test->data_type==DATA_UDATE)
+			sprintf(msg_buf, test->message, date_print);
+		else
+			sprintf(msg_buf, test->message, val_print);
+	}
+	else
+		sprintf(msg_buf, "%s", test->message);
+	strcat(message, msg_buf);
+}
+
+static void test_convert_date(uint8_t const * const data, test_t const * const test, char * const date_str) //TODO TEST THIS (signed/unsigned)
+{
+	int32_t unixtime_signed;
+	uint32_t unixtime_unsigned;
+	int64_t unixtime64;
+	
+	switch(test->data_type)
+	{
+		case DATA_DATE: //signed
+			unixtime_signed=helper_get_value_signed(data, 4, test->endian);
+			unixtime64=unixtime_signed;
+			break;
+		
+		case DATA_UDATE: //unsigned
+			unixtime_unsigned=helper_get_value_unsigned(data, 4, test->endian);
+			unixtime64=unixtime_unsigned;
+			break;
+		
+		default:
+			errx(1, "test_convert_data: invalid data_type");
+			break;
+	}
+	
+	ctime_r(&unixtime64, date_str);
+}
+
+//bytes read by a test, for strings without value (TEST_TRUE) it depends on the data
+static uint_fast8_t get_data_size(test_t const * const test)
+{
+	switch(test->data_type)
+	{
+		case DATA_STRING: return (test->test_type==TEST_TRUE)?0:test->string.nb_bytes;
+		case DATA_INT8: case DATA_UINT8: return 1;
+		case DATA_INT16: case DATA_UINT16: return 2;
+		case DATA_DATE: case DATA_UDATE: case DATA_INT32: case DATA_UINT32: return 4;
+		case DATA_INT64: case DATA_UINT64: return 8;
+	}
+	
+	return 0;
+}
+
+bool fsfuzz_resolve_offset(uint8_t const * const data, test_t const * const test, const uint_fast32_t blocksize, const uint64_t parent_end, uint64_t * const offset)
+{
+	uint64_t pos=test->offset;
+	
+	if(test->offset_relative)
+		pos+=parent_end;
+	
+	if(test->offset_indirect)
+	{
+		const uint_fast8_t nb_bytes=(test->indirect_type==DATA_UINT8)?1:(test->indirect_type==DATA_UINT16)?2:(test->indirect_type==DATA_UINT32)?4:8;
+		
+		if(pos>=blocksize || nb_bytes>blocksize-pos)
+			return false;
+		
+		pos=get_value_unsigned(data+pos, test->indirect_type, test->indirect_endian)+test->indirect_adjust; //a negative result wraps around and is outside the block too
+	}
+	
+	//the data itself, unlike for absolute offsets this can't be checked once by fsfuzz_init()
+	if(pos>=blocksize || get_data_size(test)>blocksize-pos)
+		return false;
+	
+	(*offset)=pos;
+	return true;
+}
+
+testresult_t fsfuzz_make_test(uint8_t const * const data, test_t const * const test, const uint_fast32_t blocksize, const uint64_t parent_end, char * const message, test_value_t * const value)
+{
+	bool test_done=false;
+	bool is_signed=false;
+	bool result=false;
+	bool force_true=false;
+	
+	int64_t val_s;
+	uint64_t val_u;
+	int64_t val_print=0;
+	char date_str[SZ_DATE_STR]={'\0'};
+	uint64_t offset=test->offset;
+	
+	value->level=test->level;
+	value->offset=offset;
+	value->type=VALUE_NONE;
+	
+	//only child tests can have such an offset (see parse_magic.pl) and they are only made if their parent matched, level is checked first so the tests on level 0 made at every offset don't even touch the fields at the end of test_t
+	if(test->level && (test->offset_relative || test->offset_indirect))
+	{
+		if(!fsfuzz_resolve_offset(data, test, blocksize, parent_end, &offset))
+			return TEST_FAILURE; //garbage pointer, not a reason to call the result invalid
+		value->offset=offset;
+	}
+	else if(offset>blocksize) //see blocksize_too_small
+	{
+		message[0]='\0'; //dont return any message here as it would spam the user with the same message again and again if option --show-invalid was specified
+		
+		return TEST_INVALID;
+	}
+	
+	value->end=offset+get_data_size(test);
+	
+	switch(test->data_type)
+	{
+		case DATA_STRING:
+			switch(test->test_type)
+			{
+				case TEST_EQUAL:
+					if(!memcmp(data+offset, test->string.bytes, test->string.nb_bytes))
+						result=true;
+					break;
+				
+				case TEST_NOT_VALUE:
+					if(memcmp(data+offset, test->string.bytes, test->string.nb_bytes))
+						result=true;
+					break;
+				
+				case TEST_TRUE:
+					if(offset<blocksize)
+					{
+						uint8_t const * const nul=memchr(data+offset, '\0', blocksize-offset);
+						value->end=nul?(uint64_t)(nul-data):blocksize;
+					}
+					result=true;
+					break;
+				
+				default:
+					errx(1, "fsfuzz_make_test: unimpl test for DATA_STRING");
+					break;
+			}
+			test_done=true;
+			break;
+		
+		case DATA_DATE:
+		case DATA_UDATE:
+			test_convert_date(data+offset, test, date_str);
+			value->type=VALUE_DATE;
+			strncpy(value->str, date_str, SZ_VALUE_STR-1);
+			value->str[SZ_VALUE_STR-1]='\0';
+			value->str[strcspn(value->str, "\n")]='\0';
+			test_done=true; //FIXME add tests for this data type
+			result=true;
+			break;
+			
+		
+		case DATA_INT8:
+		case DATA_INT16:
+		case DATA_INT32:
+		case DATA_INT64:
+			is_signed=true;
+			break;
+		
+		case DATA_UINT8:
+		case DATA_UINT16:
+		case DATA_UINT32:
+		case DATA_UINT64:
+			break;
+	}
+	
+	if(is_signed && !test_done)
+	{
+		val_s=get_value_signed(data+offset, test->data_type, test->endian);
+		switch(test->operation_on_value)
+		{
+			case DATAOP_NONE:
+				break;
+			
+			case DATAOP_AND:
+				val_s&=(int64_t)test->operand;
+				break;
+			
+			case DATAOP_MULTIPLY:
+				val_s*=(int64_t)test->operand;
+				break;
+		}
+	}
+	
+	if(is_signed)
+	{
+		test_done=true;
+		switch(test->test_type)
+		{
+			case TEST_TRUE:
+				force_true=true;
+				break;
+			
+			case TEST_EQUAL:
+				if(val_s==test->value_signed)
+					result=true;
+				break;
+			
+			case TEST_LESS_THAN:
+				if(val_s<test->value_signed)
+					result=true;
+				break;
+			
+			case TEST_MORE_THAN:
+				if(val_s>test->value_signed)
+					result=true;
+				break;
+			
+			case TEST_BITS_SET:
+				if((val_s&test->value_signed)==test->value_signed)
+					result=true;
+				break;
+			
+			case TEST_NOT_VALUE:
+				if(val_s!=test->value_signed)
+					result=true;
+				break;
+		}
+		val_print=val_s;
+		value->type=VALUE_SIGNED;
+		value->value_signed=val_s;
+	}
+
+	if(!is_signed && !test_done)
+	{
+		val_u=get_value_unsigned(data+offset, test->data_type, test->endian);
+		switch(test->operation_on_value)
+		{
+			case DATAOP_NONE:
+				break;
+			
+			case DATAOP_AND:
+				val_u&=test->operand;
+				break;
+			
+			case DATAOP_MULTIPLY:
+				val_u*=test->operand;
+				break;
+		}
+	}
+		
+	if(!is_signed && !test_done)
+	{
+		test_done=true;
+		switch(test->test_type)
+		{
+			case TEST_TRUE:
+				force_true=true;
+				break;
+			
+			case TEST_EQUAL:
+				if(val_u==test->value_unsigned)
+					result=true;
+				break;
+			
+			case TEST_LESS_THAN:
+				if(val_u<test->value_unsigned)
+					result=true;
+				break;
+			
+			case TEST_MORE_THAN:
+				if(val_u>test->value_unsigned)
+					result=true;
+				break;
+			
+			case TEST_BITS_SET:
+				if((val_u&test->value_unsigned)==test->value_unsigned)
+					result=true;
+				break;
+			
+			case TEST_NOT_VALUE:
+				if(val_u!=test->value_unsigned)
+					result=true;
+				break;
+		}
+		val_print=val_u;
+		value->type=VALUE_UNSIGNED;
+		value->value_unsigned=val_u;
+	}
+			
+	if(force_true)
+	{
+		test_make_message(data, blocksize, offset, val_print, date_str, test, message);		
+		return TEST_SUCCESS;
+	}
+	
+	if(result)
+	{
+		if(test->tag_invalid)
+		{
+			//even if the result is invalid process the message, might be useful (and even needed for option --show-invalid)
+			test_make_message(data, blocksize, offset, val_print, date_str, test, message);
+			return TEST_INVALID;
+		}
+		else
+		{
+			test_make_message(data, blocksize, offset, val_print, date_str, test, message);
+			return TEST_SUCCESS;
+		}
+	}
+	else
+		return TEST_FAILURE;
+}
+
+void fsfuzz_init(fsfuzz_t * const ctx, const uint_fast32_t blocksize)
+{
+	uint_fast32_t ind_magic;
+	uint_fast8_t ind_tests;
+	
+	memset(ctx, 0, sizeof(fsfuzz_t));
+	ctx->blocksize=blocksize;
+	ctx->search_magic=true;
+	
+	for(ind_magic=0; ind_magic<NB_ENTRIES_MAGIC; ind_magic++)
+	{
+		for(ind_tests=0; ind_tests<magic[ind_magic].nb_tests; ind_tests++)
+		{
+			if(magic[ind_magic].tests[ind_tests].offset>blocksize)
+				ctx->blocksize_too_small=true;
+		}
+	}
+	
+	verify_init();
+	
+	ctx->block=malloc(blocksize);
+	if(ctx->block==NULL)
+		err(1, "malloc for block failed");
+}
+
+void fsfuzz_free(fsfuzz_t * const ctx)
+{
+	free(ctx->block);
+	ctx->block=NULL;
+}
+
+uint_fast32_t fsfuzz_search_magic(fsfuzz_t const * const ctx, uint8_t const * const data, const uint_fast32_t startpos)
+{
+	const uint_fast32_t blocksize=ctx->blocksize;
+	uint_fast32_t ind_magic;
+	uint_fast32_t nb_hits=0;
+	uint_fast8_t ind_tests, old_ind_tests;
+	uint_fast8_t current_level;
+	bool level_down;
+	bool is_invalid;
+	char message[SZ_MESSAGE];
+	
+	for(ind_magic=0; ind_magic<NB_ENTRIES_MAGIC; ind_magic++)
+	{
+		bool once_succeeded[NB_LEVELS_MAX+1]={0};
+		uint64_t level_end[NB_LEVELS_MAX+1]; //end of the data of the last test that matched on each level, for relative offsets
+		uint64_t fs_size=0;
+		test_value_t values[NB_TESTS_MAX];
+		uint_fast8_t nb_values=0;
+		
+		current_level=0;
+		level_down=false;
+		is_invalid=false;
+		message[0]='\0';
+		
+		//this block was a pain to get right and might benefit from some cleanup...
+		for(ind_tests=0; ind_tests<magic[ind_magic].nb_tests; )
+		{
+			current_level=magic[ind_magic].tests[ind_tests].level;
+			testresult_t res=fsfuzz_make_test(data, &magic[ind_magic].tests[ind_tests], blocksize, current_level?level_end[current_level-1]:0, message, &values[nb_values]);
+			if(ctx->stats && ind_tests==0)
+			{
+				ctx->stats->magic_evaluated[ind_magic]++;
+				if(res==TEST_SUCCESS)
+					ctx->stats->magic_passed[ind_magic]++;
+			}
+			if(res==TEST_INVALID)
+			{
+				nb_values++;
+				is_invalid=true;
+				break;
+			}
+			else if(res==TEST_SUCCESS)
+			{
+				if(magic[ind_magic].tests[ind_tests].tag_size)
+				{
+					if(values[nb_values].type==VALUE_SIGNED) //a negative size is garbage, treat it as unknown
+						fs_size=(values[nb_values].value_signed>0)?values[nb_values].value_signed:0;
+					else
+						fs_size=values[nb_values].value_unsigned;
+				}
+				level_end[current_level]=values[nb_values].end;
+				nb_values++;
+				once_succeeded[current_level]=true;
+				
+				//check if next test in database has the same or a higher level
+				ind_tests++;
+				if(ind_tests<magic[ind_magic].nb_tests && magic[ind_magic].tests[ind_tests].level>=current_level)
+					continue; //if so execute test
+				else if(current_level>0)
+					level_down=true; //next test is lower level -> going down one level
+				else
+					break; //we are at level 0 and there is no other test with same or higher level -> stop
+			}
+			if(res==TEST_FAILURE || level_down)
+			{
+				if(current_level>0 && once_succeeded[current_level-1])
+				{
+					old_ind_tests=ind_tests;
+					if(res==TEST_FAILURE)
+					{
+						//failure but success at last level, continue on same level if there are more tests
+						do
+						{
+							ind_tests++;
+						} while(ind_tests<magic[ind_magic].nb_tests && magic[ind_magic].tests[ind_tests].level>current_level);
+					}
+					
+					//check if no other test on same level found
+					if(ind_tests==magic[ind_magic].nb_tests)
+					{
+						//go one level down
+						ind_tests=old_ind_tests;
+						do
+						{
+							ind_tests++;
+						} while(ind_tests<magic[ind_magic].nb_tests && magic[ind_magic].tests[ind_tests].level!=(current_level-1));
+					}
+				}
+				else
+					break; //stop
+			}
+		}
+		
+		if(!is_invalid && strlen(message))
+		{
+			verify_status_t status=VERIFY_UNVERIFIED;
+			
+			if(ctx->stats)
+				ctx->stats->magic_valid[ind_magic]++;
+			
+			if(ctx->verify)
+				status=verify_hit(data, blocksize, ind_magic);
+			
+			if(status!=VERIFY_REJECTED)
+				nb_hits++;
+			
+			if(fs_size==0)
+				fs_size=verify_fs_size(data, blocksize, ind_magic);
+			
+			if(ctx->on_hit)
+			{
+				hit_t hit={ .type=HIT_MAGIC, .offset=startpos, .ind_magic=ind_magic, .message=message, .values=values, .nb_values=nb_values, .verify_status=status, .fs_size=fs_size };
+				ctx->on_hit(&hit, data, ctx->hit_userdata);
+			}
+		}
+		else if(is_invalid && strlen(message))
+		{
+			if(ctx->stats)
+				ctx->stats->magic_invalid[ind_magic]++;
+			
+			if(ctx->report_invalid && ctx->on_hit)
+			{
+				hit_t hit={ .type=HIT_INVALID, .offset=startpos, .ind_magic=ind_magic, .ind_test=ind_tests, .message=message, .values=values, .nb_values=nb_values, .verify_status=VERIFY_UNVERIFIED }; //the loop above stopped at the test that made the result invalid
+				ctx->on_hit(&hit, data, ctx->hit_userdata);
+			}
+		}
+	}
+	
+	return nb_hits;
+}
+
+//a match is seen in every block that contains it, the ring has the match reported last for each position inside the block
+static bool match_already_reported(uint_fast32_t * const reported, const uint_fast32_t blocksize, const uint_fast32_t found_pos)
+{
+	uint_fast32_t * const slot=&reported[found_pos%blocksize];
+	
+	if((*slot)==found_pos+1) //+1 so a zeroed ring means "nothing reported"
+		return true;
+	
+	(*slot)=found_pos+1;
+	return false;
+}
+
+static void report_string(fsfuzz_t const * const ctx, uint8_t const * const data, const uint_fast32_t startpos, const uint_fast32_t match_index, uint_fast32_t * const reported)
+{
+	hit_t hit={ .type=HIT_STRING, .offset=startpos+match_index, .message=ctx->searchstring, .match_index=match_index };
+	
+	if(reported && match_already_reported(reported, ctx->blocksize, hit.offset))
+		return;
+	
+	if(ctx->on_hit)
+		ctx->on_hit(&hit, data, ctx->hit_userdata);
+}
+
+void fsfuzz_search_string(fsfuzz_t const * const ctx, uint8_t const * const data, const uint_fast32_t startpos, const bool only_new_bytes, uint_fast32_t * const reported)
+{
+	const uint_fast32_t blocksize=ctx->blocksize;
+	char const * const searchstring=ctx->searchstring;
+	const bool match_entire_word=ctx->match_entire_word;
+	size_t len=strlen(searchstring)+(match_entire_word?1:0); //we can do this match_entire_word-stuff because in C the string will always be 0 terminated
+	const uint8_t first=searchstring[0];
+	const uint8_t last=searchstring[len-1];
+	uint_fast32_t i;
+	
+	if(len>blocksize)
+		return;
+	
+	const uint_fast32_t last_start=blocksize-len;
+	
+	//if the decrypted bytes don't depend on their position inside the block everything except a match ending on the byte that just entered the block has already been seen
+	i=only_new_bytes?last_start:0;
+	
+	//compare first and last byte of the string at 16 positions at once, only candidates get a full compare
+#ifdef __SSE2__
+	const __m128i v_first=_mm_set1_epi8(first);
+	const __m128i v_last=_mm_set1_epi8(last);
+	
+	for(; i+16<=last_start+1; i+=16)
+	{
+		__m128i eq_first=_mm_cmpeq_epi8(v_first, _mm_loadu_si128((__m128i const *)(data+i)));
+		__m128i eq_last=_mm_cmpeq_epi8(v_last, _mm_loadu_si128((__m128i const *)(data+i+len-1)));
+		uint_fast32_t mask=_mm_movemask_epi8(_mm_and_si128(eq_first, eq_last));
+		
+		while(mask)
+		{
+			uint_fast32_t k=i+__builtin_ctz(mask);
+			if(!memcmp(data+k+1, searchstring+1, len-2))
+				report_string(ctx, data, startpos, k, reported);
+			mask&=mask-1;
+		}
+	}
+#endif
+	
+	for(; i<=last_start; i++)
+	{
+		if(data[i]==first && data[i+len-1]==last && !memcmp(data+i+1, searchstring+1, len-2))
+			report_string(ctx, data, startpos, i, reported);
+	}
+}
+
+uint_fast32_t fsfuzz_scan_buffer(fsfuzz_t * const ctx, uint8_t const * const data, const uint_fast32_t size)
+{
+	const uint_fast32_t blocksize=ctx->blocksize;
+	uint_fast32_t * string_reported=NULL;
+	uint_fast32_t nb_hits=0;
+	uint_fast32_t startpos;
+	
+	if(ctx->searchstring)
+	{
+		string_reported=calloc(blocksize, sizeof(uint_fast32_t));
+		if(string_reported==NULL)
+			err(1, "calloc for string_reported failed");
+	}
+	
+	ctx->stop=false;
+	
+	for(startpos=0; startpos+blocksize<=size && !ctx->stop; startpos++)
+	{
+		memcpy(ctx->block, &data[startpos], blocksize);
+		ctx->decrypt(ctx->block, blocksize, ctx->decrypt_userdata);
+		
+		if(ctx->searchstring)
+			fsfuzz_search_string(ctx, ctx->block, startpos, ctx->position_independent && startpos>0, string_reported);
+		
+		if(ctx->search_magic)
+			nb_hits+=fsfuzz_search_magic(ctx, ctx->block, startpos);
+	}
+	
+	free(string_reported);
+	
+	return nb_hits;
+}
+
+uint_fast32_t fsfuzz_scan_file(fsfuzz_t * const ctx, char const * const filename)
+{
+	FILE * inp=fopen(filename, "rb");
+	if(!inp)
+		err(1, "can't open \"%s\"", filename);
+	if(fseek(inp, 0, SEEK_END))
+		err(1, "fseek to end of \"%s\" failed", filename);
+	size_t fsize=ftell(inp);
+	if(fseek(inp, 0, SEEK_SET))
+		err(1, "fseek to beginning of \"%s\" failed", filename);
+	uint8_t * data=malloc(fsize);
+	if(data==NULL)
+		err(1, "malloc for \"%s\" failed", filename);
+	if(fsize && fread(data, fsize, 1, inp)!=1)
+		err(1, "fread for \"%s\" failed", filename);
+	fclose(inp);
+	
+	uint_fast32_t nb_hits=fsfuzz_scan_buffer(ctx, data, fsize);
+	
+	free(data);
+	
+	return nb_hits;
+}
@@ -0,0 +1,107 @@
+#ifndef __LIBFSFUZZ_H__
+#define __LIBFSFUZZ_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+#include "magicdata.h"
+#include "verify.h"
+#include "jsonl.h"
+#include "stats.h"
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define SZ_MESSAGE 1024 //1kB should be enough i guess
+
+typedef enum
+{
+	TEST_INVALID,
+	TEST_SUCCESS,
+	TEST_FAILURE
+} testresult_t;
+
+typedef enum
+{
+	HIT_MAGIC, //valid result of an entry of the magic-database
+	HIT_INVALID, //only reported with report_invalid
+	HIT_STRING
+} hit_type_t;
+
+typedef struct
+{
+	hit_type_t type;
+	uint_fast32_t offset; //of the start of the hit in the scanned data
+
+	//HIT_MAGIC and HIT_INVALID
+	uint_fast32_t ind_magic;
+	uint_fast8_t ind_test; //HIT_INVALID: the test that made the result invalid
+	char const * message;
+	test_value_t const * values;
+	uint_fast32_t nb_values;
+	verify_status_t verify_status; //always VERIFY_UNVERIFIED without verify
+	uint64_t fs_size; //0 if unknown
+
+	//HIT_STRING
+	uint_fast32_t match_index; //position of the match inside the block
+} hit_t;
+
+//decrypts a block in place, like user_decrypt_block()
+typedef void (*fsfuzz_decrypt_t)(uint8_t * const block, const uint_fast32_t blocksize, void * const userdata);
+//block is the decrypted block the hit was found in, both are only valid during the call
+typedef void (*fsfuzz_hit_callback_t)(hit_t const * const hit, uint8_t const * const block, void * const userdata);
+
+typedef struct
+{
+	uint_fast32_t blocksize;
+
+	//everything below can be changed after fsfuzz_init()
+	fsfuzz_decrypt_t decrypt;
+	void * decrypt_userdata;
+	fsfuzz_hit_callback_t on_hit; //may be NULL
+	void * hit_userdata;
+
+	bool search_magic; //default true
+	bool verify;
+	bool report_invalid;
+	char const * searchstring; //NULL for none, at least 2 chars
+	bool match_entire_word; //searchstring must be 0-terminated
+	bool position_independent; //see --position-independent
+	stats_t * stats; //counters per magic entry are updated if not NULL
+	bool stop; //can be set by on_hit to end fsfuzz_scan_buffer() early
+
+	bool blocksize_too_small; //set by fsfuzz_init() if at least one test of the magic-database is outside the block
+
+	uint8_t * block; //private
+} fsfuzz_t;
+
+//errors are not returned: like the rest of fsfuzz the library calls err()/errx() and the whole process exits, on out of memory, a file that can't be read (fsfuzz_scan_file()) and on tests of the magic-database that are not implemented (fsfuzz_make_test())
+//thread-safe, each thread needs its own fsfuzz_t
+void fsfuzz_init(fsfuzz_t * const ctx, const uint_fast32_t blocksize);
+void fsfuzz_free(fsfuzz_t * const ctx);
+
+//runs the magic-database on a decrypted block found at startpos, returns the number of valid hits not rejected by verify
+uint_fast32_t fsfuzz_search_magic(fsfuzz_t const * const ctx, uint8_t const * const block, const uint_fast32_t startpos);
+//reports every match of ctx->searchstring in a decrypted block, reported is a ring of blocksize entries to report each match only once over consecutive blocks (zeroed before the first call) or NULL
+void fsfuzz_search_string(fsfuzz_t const * const ctx, uint8_t const * const block, const uint_fast32_t startpos, const bool only_new_bytes, uint_fast32_t * const reported);
+
+//decrypt and search every offset of data, returns the number of valid hits not rejected by verify
+uint_fast32_t fsfuzz_scan_buffer(fsfuzz_t * const ctx, uint8_t const * const data, const uint_fast32_t size);
+uint_fast32_t fsfuzz_scan_file(fsfuzz_t * const ctx, char const * const filename);
+
+//a single test of the magic-database, message gets the text of the test appended, parent_end is the end of the data of the parent test (see test_value_t, only used for relative offsets)
+testresult_t fsfuzz_make_test(uint8_t const * const data, test_t const * const test, const uint_fast32_t blocksize, const uint64_t parent_end, char * const message, test_value_t * const value);
+//the offset of the data of a test with a relative or indirect offset, false if it (or the pointer) is outside the block
+bool fsfuzz_resolve_offset(uint8_t const * const data, test_t const * const test, const uint_fast32_t blocksize, const uint64_t parent_end, uint64_t * const offset);
+//replaces everything that is not printable ASCII in the first len chars of str by '?'
+void fsfuzz_mask_unprintable(char * const str, ssize_t len);
+
+#endif
@@ -18,866 +18,882 @@ AGPLv3+ and NO WARRANTY!
 const magic_t magic[NB_ENTRIES_MAGIC]={
 	{ 6,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 6, {0x7f, 0x13, 0x00, 0x00, 0x00, 0x00} }, false, false, false, "Minix filesystem, V1, little endian," },
-			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld zones" },
-			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid zone count " },
-			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, true, false, ", bootable" },
-			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, false, "" },
-			{ 2, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x00, 0x00, 0x00, 0x00, 0x00} }, true, false, false, "" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 6, {0x7f, 0x13, 0x00, 0x00, 0x00, 0x00} }, false, false, false, false, "Minix filesystem, V1, little endian," },
+			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld zones" },
+			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid zone count " },
+			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, true, false, ", bootable" },
+			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, false, false, "" },
+			{ 2, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x00, 0x00, 0x00, 0x00, 0x00} }, true, false, false, false, "" },
 		}
 	},
 	{ 6,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 6, {0x13, 0x7f, 0x00, 0x00, 0x00, 0x00} }, false, false, false, "Minix filesystem, V1, big endian," },
-			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld zones" },
-			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid zone count " },
-			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, true, false, ", bootable" },
-			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, false, "" },
-			{ 2, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x00, 0x00, 0x00, 0x00, 0x00} }, true, false, false, "" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 6, {0x13, 0x7f, 0x00, 0x00, 0x00, 0x00} }, false, false, false, false, "Minix filesystem, V1, big endian," },
+			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld zones" },
+			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid zone count " },
+			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, true, false, ", bootable" },
+			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, false, false, "" },
+			{ 2, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x00, 0x00, 0x00, 0x00, 0x00} }, true, false, false, false, "" },
 		}
 	},
 	{ 6,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 6, {0x8f, 0x13, 0x00, 0x00, 0x00, 0x00} }, false, false, false, "Minix filesystem, V1, little endian, 30 char names," },
-			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld zones" },
-			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid zone count " },
-			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, true, false, ", bootable" },
-			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, false, "" },
-			{ 2, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x00, 0x00, 0x00, 0x00, 0x00} }, true, false, false, "" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 6, {0x8f, 0x13, 0x00, 0x00, 0x00, 0x00} }, false, false, false, false, "Minix filesystem, V1, little endian, 30 char names," },
+			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld zones" },
+			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid zone count " },
+			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, true, false, ", bootable" },
+			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, false, false, "" },
+			{ 2, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x00, 0x00, 0x00, 0x00, 0x00} }, true, false, false, false, "" },
 		}
 	},
 	{ 6,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 6, {0x13, 0x8f, 0x00, 0x00, 0x00, 0x00} }, false, false, false, "Minix filesystem, V1, big endian, 30 char names," },
-			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld zones" },
-			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid zone count " },
-			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, true, false, ", bootable" },
-			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, false, "" },
-			{ 2, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x00, 0x00, 0x00, 0x00, 0x00} }, true, false, false, "" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 6, {0x13, 0x8f, 0x00, 0x00, 0x00, 0x00} }, false, false, false, false, "Minix filesystem, V1, big endian, 30 char names," },
+			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld zones" },
+			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid zone count " },
+			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, true, false, ", bootable" },
+			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x6d, 0x69, 0x6e, 0x69, 0x78} }, false, false, false, false, "" },
+			{ 2, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 5, {0x00, 0x00, 0x00, 0x00, 0x00} }, true, false, false, false, "" },
 		}
 	},
 	{ 7,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x68, 0x24} }, false, false, false, "Minix filesystem, V2, little endian," },
-			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld zones" },
-			{ 1, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, ", state: " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "clean" },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "has errors" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x68, 0x24} }, false, false, false, false, "Minix filesystem, V2, little endian," },
+			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld zones" },
+			{ 1, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, ", state: " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "clean" },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "has errors" },
 		}
 	},
 	{ 7,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x24, 0x68} }, false, false, false, "Minix filesystem, V2, big endian," },
-			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld zones" },
-			{ 1, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, ", state: " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "clean" },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "has errors" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x24, 0x68} }, false, false, false, false, "Minix filesystem, V2, big endian," },
+			{ 1, 0x402, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld zones" },
+			{ 1, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, ", state: " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "clean" },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "has errors" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x13, 0x9f} }, false, false, false, "Minix filesystem V1, big endian, 30 char names, with compression," },
-			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes" },
-			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid inodes count " },
-			{ 1, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, ", state: " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "clean" },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "has errors" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x13, 0x9f} }, false, false, false, false, "Minix filesystem V1, big endian, 30 char names, with compression," },
+			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes" },
+			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid inodes count " },
+			{ 1, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, ", state: " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "clean" },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "has errors" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x9f, 0x13} }, false, false, false, "Minix filesystem V1, little endian, 30 char names, with compression," },
-			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes" },
-			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid inodes count " },
-			{ 1, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, ", state: " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "clean" },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "has errors" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x9f, 0x13} }, false, false, false, false, "Minix filesystem V1, little endian, 30 char names, with compression," },
+			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes" },
+			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid inodes count " },
+			{ 1, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, ", state: " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "clean" },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "has errors" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x24, 0x88} }, false, false, false, "Minix filesystem V2, big endian, 30 char names, with compression," },
-			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes" },
-			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid inodes count " },
-			{ 1, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, ", state: " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "clean" },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "has errors" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x24, 0x88} }, false, false, false, false, "Minix filesystem V2, big endian, 30 char names, with compression," },
+			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes" },
+			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid inodes count " },
+			{ 1, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, ", state: " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "clean" },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "has errors" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x88, 0x24} }, false, false, false, "Minix filesystem V2, little endian, 30 char names, with compression," },
-			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes" },
-			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid inodes count " },
-			{ 1, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, ", state: " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "clean" },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "has errors" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x88, 0x24} }, false, false, false, false, "Minix filesystem V2, little endian, 30 char names, with compression," },
+			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes" },
+			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid inodes count " },
+			{ 1, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, ", state: " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "clean" },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "has errors" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x38, 0xd1} }, false, false, false, "Minix filesystem V2.5, big endian, 30 char names," },
-			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes" },
-			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid inodes count " },
-			{ 1, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, ", state: " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "clean" },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "has errors" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x38, 0xd1} }, false, false, false, false, "Minix filesystem V2.5, big endian, 30 char names," },
+			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes" },
+			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid inodes count " },
+			{ 1, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, ", state: " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "clean" },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "has errors" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0xd1, 0x38} }, false, false, false, "Minix filesystem V2.5, little endian, 30 char names," },
-			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes" },
-			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid inodes count " },
-			{ 1, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, ", state: " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "clean" },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "has errors" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0xd1, 0x38} }, false, false, false, false, "Minix filesystem V2.5, little endian, 30 char names," },
+			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes" },
+			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid inodes count " },
+			{ 1, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, ", state: " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "clean" },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "has errors" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x38, 0xe1} }, false, false, false, "Minix filesystem V2.5, big endian, 30 char names, with compression," },
-			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes" },
-			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid inodes count " },
-			{ 1, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, ", state: " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "clean" },
-			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "has errors" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0x38, 0xe1} }, false, false, false, false, "Minix filesystem V2.5, big endian, 30 char names, with compression," },
+			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes" },
+			{ 1, 0x400, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid inodes count " },
+			{ 1, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, ", state: " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "clean" },
+			{ 2, 0x412, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "has errors" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0xe1, 0x38} }, false, false, false, "Minix filesystem V2.5, little endian, 30 char names, with compression," },
-			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes" },
-			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, ", invalid inodes count " },
-			{ 1, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, ", state: " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, true, false, "invalid state " },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "clean" },
-			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "has errors" },
+			{ 0, 0x410, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 2, {0xe1, 0x38} }, false, false, false, false, "Minix filesystem V2.5, little endian, 30 char names, with compression," },
+			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes" },
+			{ 1, 0x400, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, ", invalid inodes count " },
+			{ 1, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, ", state: " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, true, false, "invalid state " },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "clean" },
+			{ 2, 0x412, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "has errors" },
 		}
 	},
 	{ 4,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 12, {0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00} }, false, false, false, "YAFFS filesystem, little endian" },
-			{ 0, 0x4, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 6, {0x00, 0x00, 0x00, 0x01, 0xff, 0xff} }, false, false, false, "YAFFS filesystem, big endian" },
-			{ 1, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x00, 0x00, 0x00, 0x03} }, true, false, false, "(first object is not a directory)" },
-			{ 1, 0xa, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 1, {0x00} }, true, false, false, "(unexpected name in the first object entry)" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 12, {0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00} }, false, false, false, false, "YAFFS filesystem, little endian" },
+			{ 0, 0x4, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 6, {0x00, 0x00, 0x00, 0x01, 0xff, 0xff} }, false, false, false, false, "YAFFS filesystem, big endian" },
+			{ 1, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x00, 0x00, 0x00, 0x03} }, true, false, false, false, "(first object is not a directory)" },
+			{ 1, 0xa, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 1, {0x00} }, true, false, false, false, "(unexpected name in the first object entry)" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x0, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x53000000, false, false, false, "EFS2 Qualcomm filesystem super block, little endian," },
-			{ 1, 0x8, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 8, {0x45, 0x46, 0x53, 0x53, 0x75, 0x70, 0x65, 0x72} }, true, false, false, "," },
-			{ 1, 0x4, DATA_INT16, ENDIAN_LE, DATAOP_AND, 0x01, TEST_EQUAL, .value_signed=1, false, false, false, "NAND" },
-			{ 1, 0x4, DATA_INT16, ENDIAN_LE, DATAOP_AND, 0x01, TEST_EQUAL, .value_signed=0, false, false, false, "NOR" },
-			{ 1, 0x4, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version 0x%lx," },
-			{ 1, 0x18, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld blocks," },
-			{ 1, 0x10, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "0x%lx pages per block," },
-			{ 1, 0x14, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "0x%lx bytes per page" },
+			{ 0, 0x0, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x53000000, false, false, false, false, "EFS2 Qualcomm filesystem super block, little endian," },
+			{ 1, 0x8, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 8, {0x45, 0x46, 0x53, 0x53, 0x75, 0x70, 0x65, 0x72} }, true, false, false, false, "," },
+			{ 1, 0x4, DATA_INT16, ENDIAN_LE, DATAOP_AND, 0x01, TEST_EQUAL, .value_signed=1, false, false, false, false, "NAND" },
+			{ 1, 0x4, DATA_INT16, ENDIAN_LE, DATAOP_AND, 0x01, TEST_EQUAL, .value_signed=0, false, false, false, false, "NOR" },
+			{ 1, 0x4, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version 0x%lx," },
+			{ 1, 0x18, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld blocks," },
+			{ 1, 0x10, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "0x%lx pages per block," },
+			{ 1, 0x14, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "0x%lx bytes per page" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x0, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x53000000, false, false, false, "EFS2 Qualcomm filesystem super block, big endian," },
-			{ 1, 0x8, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 8, {0x53, 0x53, 0x46, 0x45, 0x72, 0x65, 0x70, 0x75} }, true, false, false, "," },
-			{ 1, 0x4, DATA_INT16, ENDIAN_BE, DATAOP_AND, 0x01, TEST_EQUAL, .value_signed=1, false, false, false, "NAND" },
-			{ 1, 0x4, DATA_INT16, ENDIAN_BE, DATAOP_AND, 0x01, TEST_EQUAL, .value_signed=0, false, false, false, "NOR" },
-			{ 1, 0x4, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version 0x%lx," },
-			{ 1, 0x18, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld blocks," },
-			{ 1, 0x10, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "0x%lx pages per block," },
-			{ 1, 0x14, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "0x%lx bytes per page" },
+			{ 0, 0x0, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x53000000, false, false, false, false, "EFS2 Qualcomm filesystem super block, big endian," },
+			{ 1, 0x8, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 8, {0x53, 0x53, 0x46, 0x45, 0x72, 0x65, 0x70, 0x75} }, true, false, false, false, "," },
+			{ 1, 0x4, DATA_INT16, ENDIAN_BE, DATAOP_AND, 0x01, TEST_EQUAL, .value_signed=1, false, false, false, false, "NAND" },
+			{ 1, 0x4, DATA_INT16, ENDIAN_BE, DATAOP_AND, 0x01, TEST_EQUAL, .value_signed=0, false, false, false, false, "NOR" },
+			{ 1, 0x4, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version 0x%lx," },
+			{ 1, 0x18, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld blocks," },
+			{ 1, 0x10, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "0x%lx pages per block," },
+			{ 1, 0x14, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "0x%lx bytes per page" },
 		}
 	},
 	{ 3,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x54, 0x52, 0x4f, 0x43} }, false, false, false, "TROC filesystem," },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld file entries" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x54, 0x52, 0x4f, 0x43} }, false, false, false, false, "TROC filesystem," },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld file entries" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
 		}
 	},
 	{ 4,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 3, {0x50, 0x46, 0x53} }, false, false, false, "/      PFS filesystem," },
-			{ 1, 0x5, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0x2E, true, false, false, "" },
-			{ 1, 0x4, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version %s," },
-			{ 1, 0xe, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld files" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 3, {0x50, 0x46, 0x53} }, false, false, false, false, "/      PFS filesystem," },
+			{ 1, 0x5, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0x2E, true, false, false, false, "" },
+			{ 1, 0x4, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version %s," },
+			{ 1, 0xe, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld files" },
 		}
 	},
 	{ 10,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x4d, 0x50, 0x46, 0x53} }, false, false, false, "MPFS filesystem, Microchip," },
-			{ 1, 0x4, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, "" },
-			{ 1, 0x4, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x5, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, "" },
-			{ 1, 0x4, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, false, false, false, "" },
-			{ 2, 0x5, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, false, "" },
-			{ 1, 0x4, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version %ld." },
-			{ 1, 0x5, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%ld," },
-			{ 1, 0x6, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, "" },
-			{ 1, 0x6, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld file entries" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x4d, 0x50, 0x46, 0x53} }, false, false, false, false, "MPFS filesystem, Microchip," },
+			{ 1, 0x4, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x5, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, false, false, false, false, "" },
+			{ 2, 0x5, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version %ld." },
+			{ 1, 0x5, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%ld," },
+			{ 1, 0x6, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, false, "" },
+			{ 1, 0x6, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld file entries" },
 		}
 	},
 	{ 17,
 		{
-			{ 0, 0x0, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x28cd3d45, false, false, false, "CramFS filesystem, little endian," },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "invalid size," },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=1073741824, true, false, false, "invalid size," },
-			{ 1, 0x4, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %lu," },
-			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=1, false, false, false, "version 2," },
-			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=2, false, false, false, "sorted_dirs," },
-			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=4, false, false, false, "hole_support," },
-			{ 1, 0x20, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0, true, false, false, "invalid" },
-			{ 1, 0x20, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "CRC 0x%.8lX," },
-			{ 1, 0x24, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "edition %lu," },
-			{ 1, 0x28, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "invalid blocks," },
-			{ 1, 0x28, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%lu blocks," },
-			{ 1, 0x2c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "invalid file count," },
-			{ 1, 0x2c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=1000000, true, false, false, "invalid file count," },
-			{ 1, 0x2c, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%lu files" },
-			{ 1, 0x4, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x4, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x28cd3d45, false, false, false, false, "CramFS filesystem, little endian," },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "invalid size," },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=1073741824, true, false, false, false, "invalid size," },
+			{ 1, 0x4, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %lu," },
+			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=1, false, false, false, false, "version 2," },
+			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=2, false, false, false, false, "sorted_dirs," },
+			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=4, false, false, false, false, "hole_support," },
+			{ 1, 0x20, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0, true, false, false, false, "invalid" },
+			{ 1, 0x20, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "CRC 0x%.8lX," },
+			{ 1, 0x24, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "edition %lu," },
+			{ 1, 0x28, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "invalid blocks," },
+			{ 1, 0x28, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%lu blocks," },
+			{ 1, 0x2c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "invalid file count," },
+			{ 1, 0x2c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=1000000, true, false, false, false, "invalid file count," },
+			{ 1, 0x2c, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%lu files" },
+			{ 1, 0x4, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x4, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
 		}
 	},
 	{ 17,
 		{
-			{ 0, 0x0, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x28cd3d45, false, false, false, "CramFS filesystem, big endian," },
-			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=1073741824, true, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size %lu," },
-			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=1, false, false, false, "version 2," },
-			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=2, false, false, false, "sorted_dirs," },
-			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=4, false, false, false, "hole_support," },
-			{ 1, 0x20, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0, true, false, false, "invalid" },
-			{ 1, 0x20, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "CRC 0x%.8lX," },
-			{ 1, 0x24, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "edition %lu," },
-			{ 1, 0x28, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "invalid blocks," },
-			{ 1, 0x28, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%lu blocks," },
-			{ 1, 0x2c, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "invalid file count," },
-			{ 1, 0x2c, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=1000000, true, false, false, "invalid file count," },
-			{ 1, 0x2c, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%lu files" },
-			{ 1, 0x4, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x4, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x28cd3d45, false, false, false, false, "CramFS filesystem, big endian," },
+			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=1073741824, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size %lu," },
+			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=1, false, false, false, false, "version 2," },
+			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=2, false, false, false, false, "sorted_dirs," },
+			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=4, false, false, false, false, "hole_support," },
+			{ 1, 0x20, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0, true, false, false, false, "invalid" },
+			{ 1, 0x20, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "CRC 0x%.8lX," },
+			{ 1, 0x24, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "edition %lu," },
+			{ 1, 0x28, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "invalid blocks," },
+			{ 1, 0x28, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%lu blocks," },
+			{ 1, 0x2c, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "invalid file count," },
+			{ 1, 0x2c, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=1000000, true, false, false, false, "invalid file count," },
+			{ 1, 0x2c, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%lu files" },
+			{ 1, 0x4, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x4, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x55, 0x42, 0x49, 0x21} }, false, false, false, "UBI volume ID header," },
-			{ 1, 0x4, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version: %ld," },
-			{ 1, 0x5, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "type: %ld," },
-			{ 1, 0x8, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "volume id: %ld," },
-			{ 1, 0x8, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_unsigned=256, true, false, false, "" },
-			{ 1, 0xc, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld" },
-			{ 1, 0xc, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0, true, false, false, "" },
-			{ 1, 0x1c, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 1, {0x00} }, true, false, false, "*12        " },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x55, 0x42, 0x49, 0x21} }, false, false, false, false, "UBI volume ID header," },
+			{ 1, 0x4, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version: %ld," },
+			{ 1, 0x5, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "type: %ld," },
+			{ 1, 0x8, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "volume id: %ld," },
+			{ 1, 0x8, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_unsigned=256, true, false, false, false, "" },
+			{ 1, 0xc, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld" },
+			{ 1, 0xc, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 1, {0x00} }, true, false, false, false, "*12        " },
 		}
 	},
-	{ 7,
+	{ 11,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x55, 0x42, 0x49, 0x23} }, false, false, false, "UBI erase count header," },
-			{ 1, 0x4, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version: %ld," },
-			{ 1, 0x5, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 1, {0x00} }, true, false, false, "*3         " },
-			{ 1, 0x8, DATA_UINT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "EC: 0x%lX," },
-			{ 1, 0x10, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "VID header offset: 0x%lX," },
-			{ 1, 0x14, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "data offset: 0x%lX" },
-			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x55, 0x42, 0x49, 0x23} }, false, false, false, false, "UBI erase count header," },
+			{ 1, 0x4, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version: %ld," },
+			{ 1, 0x5, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 1, {0x00} }, true, false, false, false, "*3         " },
+			{ 1, 0x8, DATA_UINT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "EC: 0x%lX," },
+			{ 1, 0x10, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "VID header offset: 0x%lX," },
+			{ 1, 0x14, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "data offset: 0x%lX" },
+			{ 1, 0x10, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x55, 0x42, 0x49, 0x21} }, false, false, false, false, "", .offset_indirect=true, .indirect_type=DATA_UINT32, .indirect_endian=ENDIAN_BE },
+			{ 2, 0x10, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xFFFFFFFF, true, false, false, false, "(VID header neither valid nor erased)", .offset_indirect=true, .indirect_type=DATA_UINT32, .indirect_endian=ENDIAN_BE },
+			{ 1, 0x10, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x55, 0x42, 0x49, 0x21} }, false, false, true, false, ", VID header follows", .offset_indirect=true, .indirect_type=DATA_UINT32, .indirect_endian=ENDIAN_BE },
+			{ 2, 0x0, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=1, true, false, false, false, "(unknown VID header version)", .offset_relative=true },
+			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
 		}
 	},
 	{ 24,
 		{
-			{ 0, 0x0, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x06101831, false, false, false, "UBIFS filesystem" },
-			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_LESS_THAN, .value_unsigned=6, true, false, false, "" },
-			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_MORE_THAN, .value_unsigned=7, true, false, false, " # Only look for superblock and master nodes" },
-			{ 1, 0x16, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, true, false, false, " # 2 bytes of padding should be filled with NULLs" },
-			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=6, false, false, false, "superblock node," },
-			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=7, false, false, false, "master node," },
-			{ 1, 0x4, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "CRC: 0x%lX," },
-			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=7, false, false, false, "" },
-			{ 2, 0x18, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "highest inode: %ld," },
-			{ 2, 0x20, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "commit number: %ld" },
-			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=6, false, false, false, "" },
-			{ 2, 0x18, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, true, false, false, "" },
-			{ 2, 0x1c, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "flags: 0x%lX," },
-			{ 2, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "min I/O unit size: %ld," },
-			{ 2, 0x24, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "erase block size: %ld," },
-			{ 2, 0x28, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "erase block count: %ld," },
-			{ 2, 0x2c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "max erase blocks: %ld," },
-			{ 2, 0x50, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "format version: %ld," },
-			{ 2, 0x54, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_unsigned=2, true, false, false, "" },
-			{ 2, 0x54, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "compression type:" },
-			{ 2, 0x54, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0, false, false, false, "none" },
-			{ 2, 0x54, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=1, false, false, false, "lzo" },
-			{ 2, 0x54, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=2, false, false, false, "zlib" },
-			{ 2, 0x56, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, true, false, false, "invalid padding," },
+			{ 0, 0x0, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x06101831, false, false, false, false, "UBIFS filesystem" },
+			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_LESS_THAN, .value_unsigned=6, true, false, false, false, "" },
+			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_MORE_THAN, .value_unsigned=7, true, false, false, false, " # Only look for superblock and master nodes" },
+			{ 1, 0x16, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, true, false, false, false, " # 2 bytes of padding should be filled with NULLs" },
+			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=6, false, false, false, false, "superblock node," },
+			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=7, false, false, false, false, "master node," },
+			{ 1, 0x4, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "CRC: 0x%lX," },
+			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=7, false, false, false, false, "" },
+			{ 2, 0x18, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "highest inode: %ld," },
+			{ 2, 0x20, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "commit number: %ld" },
+			{ 1, 0x14, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=6, false, false, false, false, "" },
+			{ 2, 0x18, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, true, false, false, false, "" },
+			{ 2, 0x1c, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "flags: 0x%lX," },
+			{ 2, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "min I/O unit size: %ld," },
+			{ 2, 0x24, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "erase block size: %ld," },
+			{ 2, 0x28, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "erase block count: %ld," },
+			{ 2, 0x2c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "max erase blocks: %ld," },
+			{ 2, 0x50, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "format version: %ld," },
+			{ 2, 0x54, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_unsigned=2, true, false, false, false, "" },
+			{ 2, 0x54, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "compression type:" },
+			{ 2, 0x54, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0, false, false, false, false, "none" },
+			{ 2, 0x54, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=1, false, false, false, false, "lzo" },
+			{ 2, 0x54, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=2, false, false, false, false, "zlib" },
+			{ 2, 0x56, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, true, false, false, false, "invalid padding," },
 		}
 	},
 	{ 11,
 		{
-			{ 0, 0x0, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0x1985, false, false, false, "JFFS2 filesystem, little endian" },
-			{ 1, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE001, false, false, false, "" },
-			{ 2, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE002, false, false, false, "" },
-			{ 3, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2003, false, false, false, "" },
-			{ 4, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2004, false, false, false, "" },
-			{ 5, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2006, false, false, false, "" },
-			{ 6, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE008, false, false, false, "" },
-			{ 7, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE009, true, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0x1985, false, false, false, false, "JFFS2 filesystem, little endian" },
+			{ 1, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE001, false, false, false, false, "" },
+			{ 2, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE002, false, false, false, false, "" },
+			{ 3, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2003, false, false, false, false, "" },
+			{ 4, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2004, false, false, false, false, "" },
+			{ 5, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2006, false, false, false, false, "" },
+			{ 6, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE008, false, false, false, false, "" },
+			{ 7, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE009, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
 		}
 	},
 	{ 11,
 		{
-			{ 0, 0x0, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0x1985, false, false, false, "JFFS2 filesystem, big endian" },
-			{ 1, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE001, false, false, false, "" },
-			{ 2, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE002, false, false, false, "" },
-			{ 3, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2003, false, false, false, "" },
-			{ 4, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2004, false, false, false, "" },
-			{ 5, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2006, false, false, false, "" },
-			{ 6, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE008, false, false, false, "" },
-			{ 7, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE009, true, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0x1985, false, false, false, false, "JFFS2 filesystem, big endian" },
+			{ 1, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE001, false, false, false, false, "" },
+			{ 2, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE002, false, false, false, false, "" },
+			{ 3, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2003, false, false, false, false, "" },
+			{ 4, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2004, false, false, false, false, "" },
+			{ 5, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0x2006, false, false, false, false, "" },
+			{ 6, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE008, false, false, false, false, "" },
+			{ 7, 0x2, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xE009, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
 		}
 	},
 	{ 40,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x73, 0x71, 0x73, 0x68} }, false, false, false, "Squashfs filesystem, big endian," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version %ld." },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%ld," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "compression:" },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "gzip," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "lzma," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, true, false, "gzip (non-standard type definition)," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, true, false, "xz," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, true, false, "lz4," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, true, false, "zstd," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, true, false, "," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, true, false, "," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0xc, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, "" },
-			{ 2, 0x20, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, "" },
-			{ 2, 0x27, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x73, 0x71, 0x73, 0x68} }, false, false, false, false, "Squashfs filesystem, big endian," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version %ld." },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%ld," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "compression:" },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "gzip," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "lzma," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, true, false, "gzip (non-standard type definition)," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, false, true, false, "xz," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, false, true, false, "lz4," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, false, true, false, "zstd," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, true, false, "," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, false, true, false, "," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0xc, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x20, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, false, "" },
+			{ 2, 0x27, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
 		}
 	},
 	{ 43,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x68, 0x73, 0x71, 0x73} }, false, false, false, "Squashfs filesystem, little endian," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version %ld." },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%ld," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "compression:" },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "gzip," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "lzma," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, true, false, "gzip (non-standard type definition)," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, true, false, "xz," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, true, false, "lz4," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, true, false, "zstd," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, true, false, "," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, true, false, "," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0xc, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, "" },
-			{ 2, 0x20, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, "" },
-			{ 2, 0x27, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x68, 0x73, 0x71, 0x73} }, false, false, false, false, "Squashfs filesystem, little endian," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version %ld." },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%ld," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "compression:" },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "gzip," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "lzma," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, true, false, "gzip (non-standard type definition)," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, false, true, false, "xz," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, false, true, false, "lz4," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, false, true, false, "zstd," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, true, false, "," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, false, true, false, "," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0xc, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x20, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, false, "" },
+			{ 2, 0x27, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
 		}
 	},
 	{ 43,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x73, 0x71, 0x6c, 0x7a} }, false, false, false, "Squashfs filesystem, big endian, lzma compression, " },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version %ld." },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%ld," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "compression:" },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "gzip," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "lzma," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, true, false, "gzip (non-standard type definition)," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, true, false, "lzma (non-standard type definition)," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, true, false, "lz4," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, true, false, "zstd," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, true, false, "," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, true, false, "," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0xc, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, "" },
-			{ 2, 0x20, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, "" },
-			{ 2, 0x27, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x73, 0x71, 0x6c, 0x7a} }, false, false, false, false, "Squashfs filesystem, big endian, lzma compression, " },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version %ld." },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%ld," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "compression:" },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "gzip," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "lzma," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, true, false, "gzip (non-standard type definition)," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, false, true, false, "lzma (non-standard type definition)," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, false, true, false, "lz4," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, false, true, false, "zstd," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, true, false, "," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, false, true, false, "," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0xc, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x20, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, false, "" },
+			{ 2, 0x27, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
 		}
 	},
 	{ 43,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x71, 0x73, 0x68, 0x73} }, false, false, false, "Squashfs filesystem, big endian, lzma signature," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version %ld." },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%ld," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "compression:" },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "gzip," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "lzma," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, true, false, "gzip (non-standard type definition)," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, true, false, "xz," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, true, false, "lz4," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, true, false, "zstd," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, true, false, "," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, true, false, "," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0xc, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, "" },
-			{ 2, 0x20, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, "" },
-			{ 2, 0x27, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x71, 0x73, 0x68, 0x73} }, false, false, false, false, "Squashfs filesystem, big endian, lzma signature," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version %ld." },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%ld," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "compression:" },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "gzip," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "lzma," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, true, false, "gzip (non-standard type definition)," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, false, true, false, "xz," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, false, true, false, "lz4," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, false, true, false, "zstd," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, true, false, "," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, false, true, false, "," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0xc, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x20, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, false, "" },
+			{ 2, 0x27, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
 		}
 	},
 	{ 47,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x74, 0x71, 0x73, 0x68} }, false, false, false, "Squashfs filesystem, big endian, DD-WRT signature," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version %ld." },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%ld," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "compression:" },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "gzip," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "lzma," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, true, false, "gzip (non-standard type definition)," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, true, false, "xz," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, true, false, "lz4," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, true, false, "zstd," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, true, false, "," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, true, false, "," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0xc, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, "" },
-			{ 2, 0x20, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, "" },
-			{ 2, 0x27, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x74, 0x71, 0x73, 0x68} }, false, false, false, false, "Squashfs filesystem, big endian, DD-WRT signature," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version %ld." },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%ld," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "compression:" },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "gzip," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "lzma," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, true, false, "gzip (non-standard type definition)," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, false, true, false, "xz," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, false, true, false, "lz4," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, false, true, false, "zstd," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, true, false, "," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, false, true, false, "," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0xc, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x20, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, false, "" },
+			{ 2, 0x27, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
 		}
 	},
 	{ 43,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x68, 0x73, 0x71, 0x74} }, false, false, false, "Squashfs filesystem, little endian, DD-WRT signature," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version %ld." },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%ld," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "compression:" },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "gzip," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "lzma," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, true, false, "gzip (non-standard type definition)," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, true, false, "xz," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, true, false, "lz4," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, true, false, "zstd," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, true, false, "," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, true, false, "," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0xc, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, "" },
-			{ 2, 0x20, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, "" },
-			{ 2, 0x27, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x68, 0x73, 0x71, 0x74} }, false, false, false, false, "Squashfs filesystem, little endian, DD-WRT signature," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version %ld." },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%ld," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "compression:" },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "gzip," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "lzma," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, true, false, "gzip (non-standard type definition)," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, false, true, false, "xz," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, false, true, false, "lz4," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, false, true, false, "zstd," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, true, false, "," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, false, true, false, "," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0xc, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x20, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, false, "" },
+			{ 2, 0x27, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
 		}
 	},
 	{ 43,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x73, 0x68, 0x73, 0x71} }, false, false, false, "Squashfs filesystem, little endian, non-standard signature, " },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version %ld." },
-			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%ld," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "compression:" },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, true, false, "gzip," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, true, false, "lzma," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, true, false, "gzip (non-standard type definition)," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, true, false, "xz," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, true, false, "lz4," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, true, false, "zstd," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, true, false, "," },
-			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, true, false, "," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld inodes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0xc, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, "" },
-			{ 2, 0x20, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocksize: %ld bytes," },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, "" },
-			{ 2, 0x27, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "created: %s" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "" },
-			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, "" },
-			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x73, 0x68, 0x73, 0x71} }, false, false, false, false, "Squashfs filesystem, little endian, non-standard signature, " },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10, true, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version %ld." },
+			{ 1, 0x1e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%ld," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "compression:" },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, true, false, "gzip," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, true, false, "lzma," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, true, false, "gzip (non-standard type definition)," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=4, false, false, true, false, "xz," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=5, false, false, true, false, "lz4," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=6, false, false, true, false, "zstd," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, true, false, "," },
+			{ 2, 0x14, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=6, true, false, true, false, "," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld inodes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0xc, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x20, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x33, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocksize: %ld bytes," },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=4, false, false, false, false, "" },
+			{ 2, 0x27, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "created: %s" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x3f, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x1c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, false, false, false, false, "" },
+			{ 2, 0x28, DATA_INT64, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
 		}
 	},
 	{ 27,
 		{
-			{ 0, 0x438, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0xEF53, false, false, false, "Linux EXT filesystem," },
-			{ 1, 0x404, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "blocks count: %ld," },
-			{ 1, 0x404, DATA_UINT32, ENDIAN_LE, DATAOP_MULTIPLY, 1024, TEST_TRUE, .value_unsigned=0, false, false, true, "image size: %ld," },
-			{ 1, 0x43a, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=4, true, false, false, "invalid state" },
-			{ 1, 0x43a, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, true, false, false, "invalid state" },
-			{ 1, 0x43a, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, "invalid state" },
-			{ 1, 0x43c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, true, false, false, "invalid error behavior" },
-			{ 1, 0x43c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, "invalid error behavior" },
-			{ 1, 0x43c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=4, true, false, false, "invalid major revision" },
-			{ 1, 0x43c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, "invalid major revision" },
-			{ 1, 0x43c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "rev %ld" },
-			{ 1, 0x43e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, ".%ld," },
-			{ 1, 0x45c, DATA_INT32, ENDIAN_LE, DATAOP_AND, 0x04, TEST_EQUAL, .value_signed=0, false, false, false, "ext2 filesystem data" },
-			{ 2, 0x43a, DATA_INT16, ENDIAN_LE, DATAOP_AND, 0x01, TEST_EQUAL, .value_signed=0, false, false, false, "(mounted or unclean)" },
-			{ 1, 0x45c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=0x0000004, false, false, false, "" },
-			{ 2, 0x460, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0x0000040, false, false, false, "" },
-			{ 3, 0x464, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0x0000008, false, false, false, "ext3 filesystem data" },
-			{ 3, 0x464, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=0x0000007, false, false, false, "ext4 filesystem data" },
-			{ 2, 0x460, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=0x000003f, false, false, false, "ext4 filesystem data" },
-			{ 1, 0x468, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, ", UUID=%08lx" },
-			{ 1, 0x46c, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "-%04lx" },
-			{ 1, 0x46e, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "-%04lx" },
-			{ 1, 0x470, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "-%04lx" },
-			{ 1, 0x472, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "-%08lx" },
-			{ 1, 0x474, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%04lx" },
-			{ 1, 0x478, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, "" },
-			{ 2, 0x478, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, ", volume name \"%s\"" },
+			{ 0, 0x438, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0xEF53, false, false, false, false, "Linux EXT filesystem," },
+			{ 1, 0x404, DATA_UINT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "blocks count: %ld," },
+			{ 1, 0x404, DATA_UINT32, ENDIAN_LE, DATAOP_MULTIPLY, 1024, TEST_TRUE, .value_unsigned=0, false, false, false, true, "image size: %ld," },
+			{ 1, 0x43a, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=4, true, false, false, false, "invalid state" },
+			{ 1, 0x43a, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, true, false, false, false, "invalid state" },
+			{ 1, 0x43a, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, false, "invalid state" },
+			{ 1, 0x43c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=3, true, false, false, false, "invalid error behavior" },
+			{ 1, 0x43c, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, false, "invalid error behavior" },
+			{ 1, 0x43c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=4, true, false, false, false, "invalid major revision" },
+			{ 1, 0x43c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0, true, false, false, false, "invalid major revision" },
+			{ 1, 0x43c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "rev %ld" },
+			{ 1, 0x43e, DATA_INT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, ".%ld," },
+			{ 1, 0x45c, DATA_INT32, ENDIAN_LE, DATAOP_AND, 0x04, TEST_EQUAL, .value_signed=0, false, false, false, false, "ext2 filesystem data" },
+			{ 2, 0x43a, DATA_INT16, ENDIAN_LE, DATAOP_AND, 0x01, TEST_EQUAL, .value_signed=0, false, false, false, false, "(mounted or unclean)" },
+			{ 1, 0x45c, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_BITS_SET, .value_signed=0x0000004, false, false, false, false, "" },
+			{ 2, 0x460, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0x0000040, false, false, false, false, "" },
+			{ 3, 0x464, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0x0000008, false, false, false, false, "ext3 filesystem data" },
+			{ 3, 0x464, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=0x0000007, false, false, false, false, "ext4 filesystem data" },
+			{ 2, 0x460, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=0x000003f, false, false, false, false, "ext4 filesystem data" },
+			{ 1, 0x468, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, ", UUID=%08lx" },
+			{ 1, 0x46c, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "-%04lx" },
+			{ 1, 0x46e, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "-%04lx" },
+			{ 1, 0x470, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "-%04lx" },
+			{ 1, 0x472, DATA_UINT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "-%08lx" },
+			{ 1, 0x474, DATA_UINT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%04lx" },
+			{ 1, 0x478, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, false, "" },
+			{ 2, 0x478, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, ", volume name \"%s\"" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 8, {0x2d, 0x72, 0x6f, 0x6d, 0x31, 0x66, 0x73, 0x2d} }, false, false, false, "\0      romfs filesystem, version 1" },
-			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10000000, true, false, false, "" },
-			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 1, 0x10, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x10, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "named \"%s\"" },
-			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 9, {0x2d, 0x72, 0x6f, 0x6d, 0x31, 0x66, 0x73, 0x2d, 0x00} }, false, false, false, false, "romfs filesystem, version 1" },
+			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=10000000, true, false, false, false, "" },
+			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 1, 0x10, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x10, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "named \"%s\"" },
+			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
 		}
 	},
 	{ 8,
 		{
-			{ 0, 0x10, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 7, {0x52, 0x4f, 0x4d, 0x46, 0x53, 0x20, 0x76} }, false, false, false, "D-Link ROMFS filesystem," },
-			{ 1, 0x17, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "version %s," },
-			{ 1, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x2e, 0x6d, 0x6f, 0x52} }, false, false, false, "" },
-			{ 2, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x52, 0x6f, 0x6d, 0x2e} }, true, false, false, " unknown endianness" },
-			{ 1, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x2e, 0x6d, 0x6f, 0x52} }, false, false, false, "little endian," },
-			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: <= %ld" },
-			{ 1, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x52, 0x6f, 0x6d, 0x2e} }, false, false, false, "big endian," },
-			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "size: <= %ld" },
+			{ 0, 0x10, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 7, {0x52, 0x4f, 0x4d, 0x46, 0x53, 0x20, 0x76} }, false, false, false, false, "D-Link ROMFS filesystem," },
+			{ 1, 0x17, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "version %s," },
+			{ 1, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x2e, 0x6d, 0x6f, 0x52} }, false, false, false, false, "" },
+			{ 2, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x52, 0x6f, 0x6d, 0x2e} }, true, false, false, false, " unknown endianness" },
+			{ 1, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x2e, 0x6d, 0x6f, 0x52} }, false, false, false, false, "little endian," },
+			{ 2, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: <= %ld" },
+			{ 1, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x52, 0x6f, 0x6d, 0x2e} }, false, false, false, false, "big endian," },
+			{ 2, 0x8, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: <= %ld" },
 		}
 	},
 	{ 7,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 30, {0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77} }, false, false, false, "Wind River management filesystem," },
-			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 2, {0x6f, 0x77} }, true, false, false, "," },
-			{ 1, 0x20, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, false, "compressed," },
-			{ 1, 0x20, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, "plain text," },
-			{ 1, 0x20, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x20, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, false, "" },
-			{ 1, 0x24, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld files" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 30, {0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77} }, false, false, false, false, "Wind River management filesystem," },
+			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 2, {0x6f, 0x77} }, true, false, false, false, "," },
+			{ 1, 0x20, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, false, false, "compressed," },
+			{ 1, 0x20, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, false, "plain text," },
+			{ 1, 0x20, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x20, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, false, false, "" },
+			{ 1, 0x24, DATA_INT32, ENDIAN_BE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld files" },
 		}
 	},
 	{ 7,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 30, {0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57} }, false, false, false, "Wind River management filesystem," },
-			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 2, {0x4f, 0x57} }, true, false, false, "," },
-			{ 1, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, false, "compressed," },
-			{ 1, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, "plain text," },
-			{ 1, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, "" },
-			{ 1, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, false, "" },
-			{ 1, 0x24, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "%ld files" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 30, {0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4f, 0x57} }, false, false, false, false, "Wind River management filesystem," },
+			{ 1, 0x1e, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 2, {0x4f, 0x57} }, true, false, false, false, "," },
+			{ 1, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, false, false, "compressed," },
+			{ 1, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, false, "plain text," },
+			{ 1, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=2, true, false, false, false, "" },
+			{ 1, 0x24, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "%ld files" },
 		}
 	},
 	{ 5,
 		{
-			{ 0, 0x8000, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 7, {0x00, 0x43, 0x44, 0x30, 0x30, 0x31, 0x01} }, false, false, false, "ISO 9660 Boot Record," },
-			{ 1, 0x7, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, "" },
-			{ 2, 0x7, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "Boot System Identifier: \"%.32s\"," },
-			{ 1, 0x27, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, "" },
-			{ 2, 0x27, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "Boot Identifier: \"%.32s\"" },
+			{ 0, 0x8000, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 7, {0x00, 0x43, 0x44, 0x30, 0x30, 0x31, 0x01} }, false, false, false, false, "ISO 9660 Boot Record," },
+			{ 1, 0x7, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, false, "" },
+			{ 2, 0x7, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "Boot System Identifier: \"%.32s\"," },
+			{ 1, 0x27, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, false, "" },
+			{ 2, 0x27, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "Boot Identifier: \"%.32s\"" },
 		}
 	},
 	{ 5,
 		{
-			{ 0, 0x8000, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 8, {0x01, 0x43, 0x44, 0x30, 0x30, 0x31, 0x01, 0x00} }, false, false, false, "ISO 9660 Primary Volume," },
-			{ 1, 0x8, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, "" },
-			{ 2, 0x8, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "System Identifier: \"%.32s\"," },
-			{ 1, 0x28, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, "" },
-			{ 2, 0x28, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "Volume Identifier: \"%.32s\"" },
+			{ 0, 0x8000, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 8, {0x01, 0x43, 0x44, 0x30, 0x30, 0x31, 0x01, 0x00} }, false, false, false, false, "ISO 9660 Primary Volume," },
+			{ 1, 0x8, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, false, "" },
+			{ 2, 0x8, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "System Identifier: \"%.32s\"," },
+			{ 1, 0x28, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, false, "" },
+			{ 2, 0x28, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "Volume Identifier: \"%.32s\"" },
 		}
 	},
 	{ 5,
 		{
-			{ 0, 0x0, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x1b031336, false, false, false, "Netboot image," },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_AND, 0xFFFFFF00, TEST_EQUAL, .value_signed=0, false, false, false, "" },
-			{ 2, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_AND, 0x100, TEST_EQUAL, .value_signed=0x000, false, false, false, "mode 2" },
-			{ 2, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_AND, 0x100, TEST_EQUAL, .value_signed=0x100, false, false, false, "mode 3" },
-			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_AND, 0xFFFFFF00, TEST_NOT_VALUE, .value_signed=0, true, false, false, "unknown mode " },
+			{ 0, 0x0, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0x1b031336, false, false, false, false, "Netboot image," },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_AND, 0xFFFFFF00, TEST_EQUAL, .value_signed=0, false, false, false, false, "" },
+			{ 2, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_AND, 0x100, TEST_EQUAL, .value_signed=0x000, false, false, false, false, "mode 2" },
+			{ 2, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_AND, 0x100, TEST_EQUAL, .value_signed=0x100, false, false, false, false, "mode 3" },
+			{ 1, 0x4, DATA_INT32, ENDIAN_LE, DATAOP_AND, 0xFFFFFF00, TEST_NOT_VALUE, .value_signed=0, true, false, false, false, "unknown mode " },
 		}
 	},
 	{ 3,
 		{
-			{ 0, 0x12, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x57, 0x44, 0x4b, 0x20, 0x32} }, false, false, false, ".0\x00    WDK file system, version 2.0," },
-			{ 1, 0xb, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, true, "%ld files," },
-			{ 1, 0x4, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0, false, false, true, "Last modified %s GMT" },
+			{ 0, 0x12, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x57, 0x44, 0x4b, 0x20, 0x32} }, false, false, false, false, ".0\x00    WDK file system, version 2.0," },
+			{ 1, 0xb, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, true, "%ld files," },
+			{ 1, 0x4, DATA_UDATE, ENDIAN_BE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0, false, false, false, true, "Last modified %s GMT" },
 		}
 	},
 	{ 12,
 		{
-			{ 0, 0x8001, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x43, 0x44, 0x30, 0x30, 0x31} }, false, false, false, "ISO" },
-			{ 1, 0x1800, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x4e, 0x53, 0x52, 0x30} }, false, false, false, "9660 CD-ROM filesystem data," },
-			{ 1, 0x1800, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x4e, 0x53, 0x52, 0x30} }, false, false, false, "UDF filesystem data," },
-			{ 1, 0x8002, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=1, true, false, false, "" },
-			{ 1, 0x1804, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, false, "version 1.0," },
-			{ 1, 0x1804, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, "version 2.0," },
-			{ 1, 0x1804, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, "version 3.0" },
-			{ 1, 0x1804, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=0x33, true, false, false, " version," },
-			{ 1, 0x1804, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0x31, true, false, false, " version," },
-			{ 1, 0x26, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, "" },
-			{ 2, 0x26, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "volume name: \"%s\"," },
-			{ 1, 0x7ff, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 36, {0x5c, 0x30, 0x30, 0x30, 0x43, 0x44, 0x30, 0x30, 0x31, 0x5c, 0x30, 0x30, 0x31, 0x45, 0x4c, 0x20, 0x54, 0x4f, 0x52, 0x49, 0x54, 0x4f, 0x20, 0x53, 0x50, 0x45, 0x43, 0x49, 0x46, 0x49, 0x43, 0x41, 0x54, 0x49, 0x4f, 0x4e} }, false, false, false, "bootable" },
+			{ 0, 0x8001, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x43, 0x44, 0x30, 0x30, 0x31} }, false, false, false, false, "ISO" },
+			{ 1, 0x1800, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x4e, 0x53, 0x52, 0x30} }, false, false, false, false, "9660 CD-ROM filesystem data," },
+			{ 1, 0x1800, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x4e, 0x53, 0x52, 0x30} }, false, false, false, false, "UDF filesystem data," },
+			{ 1, 0x8002, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=1, true, false, false, false, "" },
+			{ 1, 0x1804, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=1, false, false, false, false, "version 1.0," },
+			{ 1, 0x1804, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=2, false, false, false, false, "version 2.0," },
+			{ 1, 0x1804, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=3, false, false, false, false, "version 3.0" },
+			{ 1, 0x1804, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=0x33, true, false, false, false, " version," },
+			{ 1, 0x1804, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=0x31, true, false, false, false, " version," },
+			{ 1, 0x26, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, false, "" },
+			{ 2, 0x26, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "volume name: \"%s\"," },
+			{ 1, 0x7ff, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 30, {0x00, 0x43, 0x44, 0x30, 0x30, 0x31, 0x01, 0x45, 0x4c, 0x20, 0x54, 0x4f, 0x52, 0x49, 0x54, 0x4f, 0x20, 0x53, 0x50, 0x45, 0x43, 0x49, 0x46, 0x49, 0x43, 0x41, 0x54, 0x49, 0x4f, 0x4e} }, false, false, false, false, "bootable" },
+		}
+	},
+	{ 8,
+		{
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 7, {0x44, 0x4f, 0x53, 0x45, 0x4d, 0x55, 0x00} }, false, false, false, false, "DOS Emulator image" },
+			{ 1, 0x27e, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_unsigned=0xAA55, true, false, false, false, "" },
+			{ 1, 0x27e, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0xAA55, false, false, false, false, "" },
+			{ 2, 0x13, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=128, false, false, false, false, "" },
+			{ 3, 0x13, DATA_UINT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_unsigned=0x0, false, false, false, false, "", .offset_indirect=true, .indirect_type=DATA_UINT8, .indirect_endian=ENDIAN_UNDEF, .indirect_adjust=-0x1 },
+			{ 4, 0x7, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=0, false, false, true, true, ", %ld heads" },
+			{ 4, 0xb, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=0, false, false, true, true, ", %ld sectors/track" },
+			{ 4, 0xf, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=0, false, false, true, true, ", %ld cylinders" },
 		}
 	},
 	{ 4,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x43, 0x4f, 0x57, 0x44, 0x03} }, false, false, false, "VMWare3 disk image," },
-			{ 1, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "(%ld/" },
-			{ 1, 0x24, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%ld/" },
-			{ 1, 0x28, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, "%ld)" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x43, 0x4f, 0x57, 0x44, 0x03} }, false, false, false, false, "VMWare3 disk image," },
+			{ 1, 0x20, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "(%ld/" },
+			{ 1, 0x24, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%ld/" },
+			{ 1, 0x28, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, "%ld)" },
 		}
 	},
 	{ 3,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x43, 0x4f, 0x57, 0x44, 0x02} }, false, false, false, "VMWare3 undoable disk image," },
-			{ 1, 0x20, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, "" },
-			{ 1, 0x20, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "\"%s\"" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 5, {0x43, 0x4f, 0x57, 0x44, 0x02} }, false, false, false, false, "VMWare3 undoable disk image," },
+			{ 1, 0x20, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, false, "" },
+			{ 1, 0x20, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "\"%s\"" },
 		}
 	},
 	{ 2,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x56, 0x4d, 0x44, 0x4b} }, false, false, false, "VMware4 disk image" },
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x4b, 0x44, 0x4d, 0x56} }, false, false, false, "VMware4 disk image" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x56, 0x4d, 0x44, 0x4b} }, false, false, false, false, "VMware4 disk image" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x4b, 0x44, 0x4d, 0x56} }, false, false, false, false, "VMware4 disk image" },
 		}
 	},
 	{ 1,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x51, 0x46, 0x49, 0xfb} }, false, false, false, "QEMU QCOW Image" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x51, 0x46, 0x49, 0xfb} }, false, false, false, false, "QEMU QCOW Image" },
 		}
 	},
 	{ 10,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x46, 0x53, 0x3c, 0x3c} }, false, false, false, "BSD 2.x filesystem," },
-			{ 1, 0x3fc, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x3e, 0x3e, 0x46, 0x53} }, true, false, false, "(missing FSMAGIC2)," },
-			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_MULTIPLY, 1024, TEST_TRUE, .value_unsigned=0, false, false, true, "size: %ld bytes," },
-			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_MULTIPLY, 1024, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_MULTIPLY, 1024, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "total blocks: %ld," },
-			{ 1, 0x3cc, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "free blocks: %ld," },
-			{ 1, 0x3c8, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "last modified: %s" },
-			{ 1, 0x3d4, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, "" },
-			{ 2, 0x3d4, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, true, true, ", last mounted on: \"%s\"" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x46, 0x53, 0x3c, 0x3c} }, false, false, false, false, "BSD 2.x filesystem," },
+			{ 1, 0x3fc, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .string={ 4, {0x3e, 0x3e, 0x46, 0x53} }, true, false, false, false, "(missing FSMAGIC2)," },
+			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_MULTIPLY, 1024, TEST_TRUE, .value_unsigned=0, false, false, false, true, "size: %ld bytes," },
+			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_MULTIPLY, 1024, TEST_TRUE, .value_unsigned=0, false, true, false, false, "" },
+			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_MULTIPLY, 1024, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x8, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "total blocks: %ld," },
+			{ 1, 0x3cc, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "free blocks: %ld," },
+			{ 1, 0x3c8, DATA_UDATE, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "last modified: %s" },
+			{ 1, 0x3d4, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0, false, false, false, false, "" },
+			{ 2, 0x3d4, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, true, ", last mounted on: \"%s\"" },
 		}
 	},
 	{ 11,
 		{
-			{ 0, 0x0, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0xbd9a, false, false, false, "Foscam WebUI filesystem," },
-			{ 1, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, true, "checksum: 0x%lX," },
-			{ 1, 0x10, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, true, false, false, "invalid first file name length," },
-			{ 1, 0x10, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=127, true, false, false, "invalid first file name length," },
-			{ 1, 0x14, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, false, "invalid first file name," },
-			{ 1, 0x14, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0x2E, false, false, false, "" },
-			{ 2, 0x14, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0x2F, false, false, false, "" },
-			{ 3, 0x14, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=65, true, false, false, "invalid first file name," },
-			{ 3, 0x14, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=122, true, false, false, "invalid first file name," },
-			{ 1, 0x10, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "" },
-			{ 1, 0x14, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, "first file name: \"\"" },
+			{ 0, 0x0, DATA_INT16, ENDIAN_BE, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0xbd9a, false, false, false, false, "Foscam WebUI filesystem," },
+			{ 1, 0x2, DATA_UINT16, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, true, "checksum: 0x%lX," },
+			{ 1, 0x10, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=3, true, false, false, false, "invalid first file name length," },
+			{ 1, 0x10, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=127, true, false, false, false, "invalid first file name length," },
+			{ 1, 0x14, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .value_signed=0, true, false, false, false, "invalid first file name," },
+			{ 1, 0x14, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0x2E, false, false, false, false, "" },
+			{ 2, 0x14, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_NOT_VALUE, .value_signed=0x2F, false, false, false, false, "" },
+			{ 3, 0x14, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_LESS_THAN, .value_signed=65, true, false, false, false, "invalid first file name," },
+			{ 3, 0x14, DATA_INT8, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_MORE_THAN, .value_signed=122, true, false, false, false, "invalid first file name," },
+			{ 1, 0x10, DATA_INT32, ENDIAN_LE, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "" },
+			{ 1, 0x14, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_TRUE, .value_unsigned=0, false, false, false, false, "first file name: \"\"" },
 		}
 	},
 	{ 1,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0xeb, 0x10, 0x90, 0x00} }, false, false, false, "QNX4 Boot Block" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0xeb, 0x10, 0x90, 0x00} }, false, false, false, false, "QNX4 Boot Block" },
 		}
 	},
 	{ 1,
 		{
-			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x68, 0x19, 0x11, 0x22} }, false, false, false, "QNX6 Super Block" },
+			{ 0, 0x0, DATA_STRING, ENDIAN_UNDEF, DATAOP_NONE, 0, TEST_EQUAL, .string={ 4, {0x68, 0x19, 0x11, 0x22} }, false, false, false, false, "QNX6 Super Block" },
 		}
 	},
 };
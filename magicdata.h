@@ -59,7 +59,7 @@ typedef struct
 {
 	uint_fast8_t level;
 	
-	uint64_t offset; //lots of stuff like relative offsets, indirect offsets, calculated offsets, ... unsupported here! 
+	uint64_t offset; //see offset_relative and offset_indirect, calculated offsets are unsupported
 	
 	datatype_t data_type;
 	
@@ -82,10 +82,18 @@ typedef struct
 	};
 		
 	bool tag_invalid;
+	bool tag_size; //value is the size of the filesystem in bytes, used by --extract
 	
 	bool flag_no_space; //'\b'
 	bool message_has_argument;
 	char * message;
+	
+	//only given for the few tests that need them (designated initializers in magicdata.c), everything else has an absolute offset
+	bool offset_relative; //'&': offset is added to the end of the data of the parent test (the last test of the level before that matched)
+	bool offset_indirect; //'(': the pointer at offset (absolute or relative) plus indirect_adjust is the offset of the test
+	datatype_t indirect_type; //DATA_UINT8...DATA_UINT64
+	endian_t indirect_endian;
+	int64_t indirect_adjust;
 } test_t;
 
 typedef struct
@@ -12,9 +12,9 @@ https://github.com/kittennbfive
 AGPLv3+ and NO WARRANTY!
 */
 
-#define NB_ENTRIES_MAGIC 52
+#define NB_ENTRIES_MAGIC 53
 #define NB_TESTS_MAX 47
 #define NB_LEVELS_MAX 7
-#define NB_BYTES_MAX 36
+#define NB_BYTES_MAX 30
 
 #endif
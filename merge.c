@@ -0,0 +1,173 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "merge.h"
+
+/*
+This file is part of fsfuzz.
+
+Merging of results from scans of parts of the same file (--start/--end/--shard). Shards never report the same magic hit as every offset belongs to exactly one of them, but a string or regex match that starts in the next shard can be found by both, so results at the same offset are dropped if they are identical. For string and regex matches only the label is compared as the bytes printed around a match depend on where the block started. Lines without an offset (banner, summaries, statistics) are dropped too, they only make sense for a single run.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define MERGE_NB_LINES_INITIAL 1024
+
+typedef struct
+{
+	uint64_t offset;
+	uint_fast32_t seq; //keeps the order of the input for results at the same offset
+	char * line;
+	size_t key_len; //the first key_len bytes of line say if two results are the same
+} merge_line_t;
+
+//JSONL records have an "offset" member, text results start with "0x... (...):", maybe after "[INVALID]: "
+static bool get_offset(char const * const line, uint64_t * const offset)
+{
+	char const * p;
+	char * end;
+	
+	if(line[0]=='{')
+	{
+		p=strstr(line, "\"offset\":");
+		if(p==NULL)
+			return false;
+		p+=strlen("\"offset\":");
+		(*offset)=strtoull(p, &end, 10);
+		return end!=p;
+	}
+	
+	p=line;
+	if(!strncmp(p, "[INVALID]: ", 11))
+		p+=11;
+	
+	if(strncmp(p, "0x", 2))
+		return false;
+	
+	(*offset)=strtoull(p, &end, 16);
+	return end!=p && (*end)==' ';
+}
+
+static size_t get_key_len(char const * const line)
+{
+	char const * p;
+	
+	if(!strncmp(line, "{\"type\":\"match\"", 16))
+	{
+		p=strstr(line, ",\"match\":");
+		if(p)
+			return p-line;
+	}
+	else
+	{
+		p=strstr(line, "): ");
+		if(p && (!strncmp(p+3, "stringmatch", 11) || !strncmp(p+3, "regexmatch", 10)))
+		{
+			p=strstr(p+3, ": ");
+			if(p)
+				return p-line;
+		}
+	}
+	
+	return strlen(line);
+}
+
+static int compare_lines(void const * a, void const * b)
+{
+	merge_line_t const * const la=a;
+	merge_line_t const * const lb=b;
+	
+	if(la->offset!=lb->offset)
+		return (la->offset<lb->offset)?-1:1;
+	
+	return (la->seq<lb->seq)?-1:(la->seq>lb->seq);
+}
+
+void merge_results(char const * const outputfile, char * const * const filenames, const uint_fast32_t nb_files)
+{
+	merge_line_t * lines=malloc(MERGE_NB_LINES_INITIAL*sizeof(merge_line_t));
+	uint_fast32_t nb_lines=0;
+	uint_fast32_t nb_lines_allocated=MERGE_NB_LINES_INITIAL;
+	uint_fast32_t nb_written=0;
+	uint_fast32_t i, j, group_start;
+	char * buffer=NULL;
+	size_t sz_buffer=0;
+	uint64_t offset;
+	
+	if(lines==NULL)
+		err(1, "malloc for merge failed");
+	
+	for(i=0; i<nb_files; i++)
+	{
+		FILE * inp=fopen(filenames[i], "r");
+		if(!inp)
+			err(1, "can't open \"%s\"", filenames[i]);
+		
+		while(getline(&buffer, &sz_buffer, inp)!=-1)
+		{
+			if(!get_offset(buffer, &offset))
+				continue;
+			
+			if(nb_lines==nb_lines_allocated)
+			{
+				nb_lines_allocated*=2;
+				lines=realloc(lines, nb_lines_allocated*sizeof(merge_line_t));
+				if(lines==NULL)
+					err(1, "realloc for merge failed");
+			}
+			
+			lines[nb_lines].offset=offset;
+			lines[nb_lines].seq=nb_lines;
+			lines[nb_lines].line=strdup(buffer);
+			if(lines[nb_lines].line==NULL)
+				err(1, "strdup for merge failed");
+			lines[nb_lines].key_len=get_key_len(buffer);
+			nb_lines++;
+		}
+		
+		fclose(inp);
+	}
+	
+	FILE * out=fopen(outputfile, "w");
+	if(!out)
+		err(1, "can't open \"%s\" for writing", outputfile);
+	
+	qsort(lines, nb_lines, sizeof(merge_line_t), compare_lines);
+	
+	//duplicates can only be at the same offset, there are never many results there
+	group_start=0;
+	for(i=0; i<nb_lines; i++)
+	{
+		bool duplicate=false;
+		
+		if(lines[i].offset!=lines[group_start].offset)
+			group_start=i;
+		
+		for(j=group_start; j<i && !duplicate; j++)
+			duplicate=(lines[i].key_len==lines[j].key_len && !memcmp(lines[i].line, lines[j].line, lines[i].key_len));
+		
+		if(!duplicate)
+		{
+			fputs(lines[i].line, out);
+			nb_written++;
+		}
+	}
+	
+	if(fclose(out))
+		err(1, "writing \"%s\" failed", outputfile);
+	
+	for(i=0; i<nb_lines; i++)
+		free(lines[i].line);
+	free(lines);
+	free(buffer);
+	
+	printf("merged %lu results from %lu files into \"%s\", %lu duplicates dropped\n", nb_written, nb_files, outputfile, nb_lines-nb_written);
+}
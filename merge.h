@@ -0,0 +1,19 @@
+#ifndef __MERGE_H__
+#define __MERGE_H__
+
+#include <stdint.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+//combines the results of several runs (JSONL or text output, not mixed) into one list ordered by offset, identical results are written only once
+void merge_results(char const * const outputfile, char * const * const filenames, const uint_fast32_t nb_files);
+
+#endif
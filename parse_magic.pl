@@ -55,11 +55,11 @@ while(($l=<$inp>))
 	}
 	elsif($l=~/^
 		(?<level>>{0,})
-		(?<offset>(?:\d+|0x[[:xdigit:]]+)(?:[+-](?:\d+|0x[[:xdigit:]]+))?)\s+
+		(?<offset>&?(?:\d+|0x[[:xdigit:]]+)(?:[+-](?:\d+|0x[[:xdigit:]]+))?|\(&?(?:\d+|0x[[:xdigit:]]+)\.[bcshSHlLqQ](?:[+-](?:\d+|0x[[:xdigit:]]+))?\))\s+
 		(?<type>u?(?:byte|short|long|quad|beshort|belong|bequad|leshort|lelong|lequad|string|bedate|ledate)(?:[&*](\d+|0x[[:xdigit:]]+))?)\s+
 		(?<test>
 			(??{if($+{type} eq 'string')
-					{'!?(?:[\\d\\w\-!]|\\\x[[:xdigit:]]{2}|\\\0\d{2})+'}
+					{'!?(?:[\\d\\w\-!]|\\\x[[:xdigit:]]{2}|\\\[0-7]{1,3})+'}
 				else
 					{'(?:[=<>&!]?(?:0x[[:xdigit:]]+|\\d+))|x'}})
 		)\s{0,}
@@ -75,7 +75,7 @@ while(($l=<$inp>))
 		if($verbose)
 		{
 			print "level:$level  offset:$offset  type:$type  test:$test  message:$message  ";
-			print "tags:",join(',', @tags) if(scalar(@tags)); #tag "invalid" used by fsfuzz, all others ignored
+			print "tags:",join(',', @tags) if(scalar(@tags)); #tags "invalid" and "size" used by fsfuzz, all others ignored
 			print "\n";
 		}
 
@@ -157,8 +157,7 @@ sub get_nb_bytes_test
 	$test=~s/^([<>&!])//;
 	if($test!~/^(0x[[:xdigit:]]+|\d+)/)
 	{
-		$test=~s/\\x([[:xdigit:]]{2})/chr(oct('0x'.$1))/ge;
-		return scalar(split(//, $test));
+		return scalar(split(//, unescape($test)));
 	}
 	
 	return 0; #not a byte array
@@ -179,7 +178,26 @@ sub make_test
 	my $op_on_value='DATAOP_NONE';
 	my $op_operand=0;
 	my $test=$ref->{'test'};
+	my $offset=$ref->{'offset'};
+	my $offset_details='';
 	
+	#relative and indirect offsets are given as designated initializers, all other tests have an absolute offset
+	if($offset=~/^\((&?)(0x[[:xdigit:]]+|\d+)\.([bcshSHlLqQ])(?:([+-])(0x[[:xdigit:]]+|\d+))?\)$/)
+	{
+		my ($relative, $pointer, $pointer_type, $sign, $adjust)=($1, $2, $3, $4, $5);
+		my %indirect_types=('b'=>'DATA_UINT8', 'c'=>'DATA_UINT8', 's'=>'DATA_UINT16', 'h'=>'DATA_UINT16', 'l'=>'DATA_UINT32', 'q'=>'DATA_UINT64');
+		my $indirect_endian=($pointer_type=~/[bc]/)?'ENDIAN_UNDEF':($pointer_type=~/[A-Z]/)?'ENDIAN_BE':'ENDIAN_LE'; #lowercase is little endian
+		
+		$offset_details.=', .offset_relative=true' if($relative eq '&');
+		$offset_details.=', .offset_indirect=true, .indirect_type='.$indirect_types{lc($pointer_type)}.', .indirect_endian='.$indirect_endian;
+		$offset_details.=', .indirect_adjust='.($sign eq '-'?'-':'').make_math($adjust) if(defined $sign);
+		$offset=$pointer;
+	}
+	elsif($offset=~s/^&//)
+	{
+		$offset_details=', .offset_relative=true';
+	}
+	die "offset \"$ref->{'offset'}\" on level 0, only child tests can have relative or indirect offsets" if($offset_details ne '' && $ref->{'level'}==0);
 	
 	$is_unsigned=1 if($type=~s/^u//);
 	
@@ -230,7 +248,7 @@ sub make_test
 		}
 		else
 		{
-			$test=~s/\\x([[:xdigit:]]{2})/chr(oct('0x'.$1))/ge;
+			$test=unescape($test);
 			$test_type_value='string';
 			@test_bytes=map { $_=sprintf('0x%02x', ord($_)) } split(//, $test);
 		}
@@ -247,9 +265,11 @@ sub make_test
 	}
 	
 	my $tag_invalid='false';
+	my $tag_size='false';
 	foreach (@{$ref->{'tags'}})
 	{
 		$tag_invalid='true' if($_ eq 'invalid');
+		$tag_size='true' if($_=~/^size:/);
 	}
 	
 	my $msg=$ref->{'message'};
@@ -263,11 +283,20 @@ sub make_test
 	my $msg_nb_args=scalar($msg=~/%[^%]/);
 	die "more than one argument in message" if($msg_nb_args>1);
 	
-	$ret.=$ref->{'level'}.', '.make_math($ref->{'offset'}).', '.$data_types{$type}.', '.$endian.', '.$op_on_value.', '.$op_operand.', '.$test_type.', '.$test_details.', '.$tag_invalid.', '.$flag_no_space.', '.($msg_nb_args?'true':'false').', "'.$msg.'" },'."\n";
+	$ret.=$ref->{'level'}.', '.make_math($offset).', '.$data_types{$type}.', '.$endian.', '.$op_on_value.', '.$op_operand.', '.$test_type.', '.$test_details.', '.$tag_invalid.', '.$tag_size.', '.$flag_no_space.', '.($msg_nb_args?'true':'false').', "'.$msg.'"'.$offset_details.' },'."\n";
 	
 	return $ret;
 }
 
+sub unescape #\xHH and octal escapes like \0 or \001 to the bytes
+{
+	my $str=shift;
+	
+	$str=~s/\\(?:x([[:xdigit:]]{2})|([0-7]{1,3}))/defined($1)?chr(oct('0x'.$1)):chr(oct($2))/ge;
+	
+	return $str;
+}
+
 sub make_math #eval() should work too but is somewhat insecure
 {
 	my $expr=shift;
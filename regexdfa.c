@@ -0,0 +1,855 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "regexdfa.h"
+
+/*
+This file is part of fsfuzz.
+
+A small regex engine without any external library: the pattern is parsed, turned into a Thompson-NFA and then into a DFA by subset construction. Searching is a table lookup per byte, no backtracking.
+
+Supported: literals, '.', [...] and [^...] with ranges, escapes \d \D \w \W \s \S \xHH \n \r \t \0 (anything else escaped is taken literally), groups (...), alternation |, * + ? {m} {m,} {m,n}. Anchors and backreferences are unsupported. '.' matches any byte.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define REPEAT_INFINITE 0xFFFF
+#define REPEAT_MAX 1000
+#define NFA_STATES_MAX 65536
+#define DFA_HASHTABLE_SIZE (4*REGEX_DFA_STATES_MAX)
+
+typedef enum
+{
+	NODE_EMPTY,
+	NODE_SET,
+	NODE_CONCAT,
+	NODE_ALT,
+	NODE_REPEAT
+} nodetype_t;
+
+typedef struct
+{
+	nodetype_t type;
+	int32_t left, right;
+	uint_fast16_t min, max;
+	uint64_t set[4];
+} node_t;
+
+typedef struct
+{
+	char const * pattern;
+	char const * p;
+	node_t * nodes;
+	uint_fast32_t nb_nodes;
+} parser_t;
+
+typedef enum
+{
+	NFA_SET,
+	NFA_SPLIT,
+	NFA_EPS,
+	NFA_MATCH
+} nfatype_t;
+
+typedef struct
+{
+	nfatype_t type;
+	uint32_t out, out1;
+	int32_t node; //for NFA_SET
+} nfastate_t;
+
+typedef struct
+{
+	nfastate_t * states;
+	uint_fast32_t nb_states;
+	uint_fast32_t nb_allocated;
+	node_t const * nodes;
+} nfa_t;
+
+static void set_add(uint64_t * const set, const uint8_t c)
+{
+	set[c>>6]|=1ULL<<(c&63);
+}
+
+static bool set_has(uint64_t const * const set, const uint8_t c)
+{
+	return (set[c>>6]>>(c&63))&1;
+}
+
+static void set_add_range(uint64_t * const set, const uint8_t from, const uint8_t to)
+{
+	uint_fast16_t c;
+	for(c=from; c<=to; c++)
+		set_add(set, c);
+}
+
+static void set_invert(uint64_t * const set)
+{
+	uint_fast8_t i;
+	for(i=0; i<4; i++)
+		set[i]=~set[i];
+}
+
+static void __attribute__((noreturn)) parse_error(parser_t const * const ps, char const * const msg)
+{
+	errx(1, "regex \"%s\": %s at position %ld", ps->pattern, msg, ps->p-ps->pattern);
+}
+
+static int32_t new_node(parser_t * const ps, const nodetype_t type)
+{
+	ps->nodes=realloc(ps->nodes, (ps->nb_nodes+1)*sizeof(node_t));
+	if(ps->nodes==NULL)
+		err(1, "realloc for regex nodes failed");
+
+	memset(&ps->nodes[ps->nb_nodes], 0, sizeof(node_t));
+	ps->nodes[ps->nb_nodes].type=type;
+	ps->nodes[ps->nb_nodes].left=-1;
+	ps->nodes[ps->nb_nodes].right=-1;
+
+	return ps->nb_nodes++;
+}
+
+static int hexval(const char c)
+{
+	if(c>='0' && c<='9')
+		return c-'0';
+	if(c>='a' && c<='f')
+		return c-'a'+10;
+	if(c>='A' && c<='F')
+		return c-'A'+10;
+	return -1;
+}
+
+//ps->p points after the backslash, returns true if the escape was a class (\d, \w, ...) and was put into set, else the byte is returned in *c
+static bool parse_escape(parser_t * const ps, uint64_t * const set, uint8_t * const c)
+{
+	char e=*ps->p;
+	bool negate=false;
+
+	if(e=='\0')
+		parse_error(ps, "trailing backslash");
+	ps->p++;
+
+	switch(e)
+	{
+		case 'D': negate=true; //fall through
+		case 'd':
+			set_add_range(set, '0', '9');
+			break;
+
+		case 'W': negate=true; //fall through
+		case 'w':
+			set_add_range(set, '0', '9');
+			set_add_range(set, 'a', 'z');
+			set_add_range(set, 'A', 'Z');
+			set_add(set, '_');
+			break;
+
+		case 'S': negate=true; //fall through
+		case 's':
+			set_add(set, ' ');
+			set_add_range(set, '\t', '\r');
+			break;
+
+		case 'x':
+			if(hexval(ps->p[0])<0 || hexval(ps->p[1])<0)
+				parse_error(ps, "\\x needs two hex digits");
+			(*c)=(hexval(ps->p[0])<<4)|hexval(ps->p[1]);
+			ps->p+=2;
+			return false;
+
+		case 'n': (*c)='\n'; return false;
+		case 'r': (*c)='\r'; return false;
+		case 't': (*c)='\t'; return false;
+		case '0': (*c)='\0'; return false;
+
+		default: (*c)=e; return false;
+	}
+
+	if(negate)
+	{
+		//only valid for a single escape, not inside a class together with other stuff - caller makes sure set was empty
+		set_invert(set);
+	}
+
+	return true;
+}
+
+static void parse_class(parser_t * const ps, uint64_t * const set)
+{
+	bool negate=false;
+	bool first=true;
+
+	if(*ps->p=='^')
+	{
+		negate=true;
+		ps->p++;
+	}
+
+	while(first || *ps->p!=']')
+	{
+		uint8_t lo, hi;
+		first=false;
+
+		if(*ps->p=='\0')
+			parse_error(ps, "unterminated []");
+
+		if(*ps->p=='\\')
+		{
+			uint64_t sub[4]={0};
+			ps->p++;
+			if(parse_escape(ps, sub, &lo))
+			{
+				uint_fast8_t i;
+				for(i=0; i<4; i++)
+					set[i]|=sub[i];
+				continue;
+			}
+		}
+		else
+			lo=*ps->p++;
+
+		hi=lo;
+		if(ps->p[0]=='-' && ps->p[1]!=']' && ps->p[1]!='\0')
+		{
+			ps->p++;
+			if(*ps->p=='\\')
+			{
+				uint64_t sub[4]={0};
+				ps->p++;
+				if(parse_escape(ps, sub, &hi))
+					parse_error(ps, "class escape can't end a range");
+			}
+			else
+				hi=*ps->p++;
+
+			if(hi<lo)
+				parse_error(ps, "invalid range");
+		}
+
+		set_add_range(set, lo, hi);
+	}
+	ps->p++; //']'
+
+	if(negate)
+		set_invert(set);
+}
+
+static int32_t parse_alt(parser_t * const ps);
+
+static int32_t parse_atom(parser_t * const ps)
+{
+	int32_t n;
+	uint8_t c;
+
+	switch(*ps->p)
+	{
+		case '(':
+			ps->p++;
+			n=parse_alt(ps);
+			if(*ps->p!=')')
+				parse_error(ps, "missing )");
+			ps->p++;
+			return n;
+
+		case '[':
+			ps->p++;
+			n=new_node(ps, NODE_SET);
+			parse_class(ps, ps->nodes[n].set);
+			return n;
+
+		case '.':
+			ps->p++;
+			n=new_node(ps, NODE_SET);
+			set_invert(ps->nodes[n].set);
+			return n;
+
+		case '\\':
+			ps->p++;
+			n=new_node(ps, NODE_SET);
+			if(!parse_escape(ps, ps->nodes[n].set, &c))
+				set_add(ps->nodes[n].set, c);
+			return n;
+
+		case '*':
+		case '+':
+		case '?':
+		case '{':
+			parse_error(ps, "nothing to repeat");
+
+		default:
+			n=new_node(ps, NODE_SET);
+			set_add(ps->nodes[n].set, *ps->p++);
+			return n;
+	}
+}
+
+static uint_fast16_t parse_number(parser_t * const ps)
+{
+	unsigned long val=0;
+
+	if(*ps->p<'0' || *ps->p>'9')
+		parse_error(ps, "number expected");
+
+	while(*ps->p>='0' && *ps->p<='9')
+	{
+		val=val*10+(*ps->p-'0');
+		if(val>REPEAT_MAX)
+			parse_error(ps, "repeat count too big");
+		ps->p++;
+	}
+
+	return val;
+}
+
+static int32_t parse_repeat(parser_t * const ps)
+{
+	int32_t n=parse_atom(ps);
+
+	while(*ps->p=='*' || *ps->p=='+' || *ps->p=='?' || *ps->p=='{')
+	{
+		int32_t r=new_node(ps, NODE_REPEAT);
+		ps->nodes[r].left=n;
+
+		switch(*ps->p++)
+		{
+			case '*': ps->nodes[r].min=0; ps->nodes[r].max=REPEAT_INFINITE; break;
+			case '+': ps->nodes[r].min=1; ps->nodes[r].max=REPEAT_INFINITE; break;
+			case '?': ps->nodes[r].min=0; ps->nodes[r].max=1; break;
+
+			case '{':
+				ps->nodes[r].min=parse_number(ps);
+				ps->nodes[r].max=ps->nodes[r].min;
+				if(*ps->p==',')
+				{
+					ps->p++;
+					if(*ps->p=='}')
+						ps->nodes[r].max=REPEAT_INFINITE;
+					else
+						ps->nodes[r].max=parse_number(ps);
+				}
+				if(*ps->p!='}')
+					parse_error(ps, "missing }");
+				ps->p++;
+				if(ps->nodes[r].max<ps->nodes[r].min)
+					parse_error(ps, "invalid repeat count");
+				break;
+		}
+
+		n=r;
+	}
+
+	return n;
+}
+
+static int32_t parse_concat(parser_t * const ps)
+{
+	int32_t n=-1;
+
+	while(*ps->p!='\0' && *ps->p!='|' && *ps->p!=')')
+	{
+		int32_t r=parse_repeat(ps);
+		if(n<0)
+			n=r;
+		else
+		{
+			int32_t c=new_node(ps, NODE_CONCAT);
+			ps->nodes[c].left=n;
+			ps->nodes[c].right=r;
+			n=c;
+		}
+	}
+
+	if(n<0)
+		n=new_node(ps, NODE_EMPTY);
+
+	return n;
+}
+
+static int32_t parse_alt(parser_t * const ps)
+{
+	int32_t n=parse_concat(ps);
+
+	while(*ps->p=='|')
+	{
+		ps->p++;
+		int32_t a=new_node(ps, NODE_ALT);
+		ps->nodes[a].left=n;
+		ps->nodes[a].right=parse_concat(ps);
+		n=a;
+	}
+
+	return n;
+}
+
+static uint32_t nfa_new_state(nfa_t * const nfa, const nfatype_t type)
+{
+	if(nfa->nb_states==NFA_STATES_MAX)
+		errx(1, "regex is too big (more than %u NFA states)", NFA_STATES_MAX);
+
+	if(nfa->nb_states==nfa->nb_allocated)
+	{
+		nfa->nb_allocated=nfa->nb_allocated?2*nfa->nb_allocated:256;
+		nfa->states=realloc(nfa->states, nfa->nb_allocated*sizeof(nfastate_t));
+		if(nfa->states==NULL)
+			err(1, "realloc for NFA states failed");
+	}
+
+	nfa->states[nfa->nb_states].type=type;
+	nfa->states[nfa->nb_states].out=0;
+	nfa->states[nfa->nb_states].out1=0;
+	nfa->states[nfa->nb_states].node=-1;
+
+	return nfa->nb_states++;
+}
+
+//every fragment has exactly one entry and one NFA_EPS exit whose out is patched by the caller; with reverse set the NFA matches the mirrored strings
+static void nfa_build(nfa_t * const nfa, const int32_t n, const bool reverse, uint32_t * const start, uint32_t * const end)
+{
+	node_t const * const node=&nfa->nodes[n];
+	uint32_t s1, e1, s2, e2;
+	uint_fast16_t i;
+
+	switch(node->type)
+	{
+		case NODE_EMPTY:
+			(*start)=(*end)=nfa_new_state(nfa, NFA_EPS);
+			break;
+
+		case NODE_SET:
+			(*start)=nfa_new_state(nfa, NFA_SET);
+			(*end)=nfa_new_state(nfa, NFA_EPS);
+			nfa->states[*start].node=n;
+			nfa->states[*start].out=(*end);
+			break;
+
+		case NODE_CONCAT:
+			nfa_build(nfa, reverse?node->right:node->left, reverse, &s1, &e1);
+			nfa_build(nfa, reverse?node->left:node->right, reverse, &s2, &e2);
+			nfa->states[e1].out=s2;
+			(*start)=s1;
+			(*end)=e2;
+			break;
+
+		case NODE_ALT:
+			nfa_build(nfa, node->left, reverse, &s1, &e1);
+			nfa_build(nfa, node->right, reverse, &s2, &e2);
+			(*start)=nfa_new_state(nfa, NFA_SPLIT);
+			(*end)=nfa_new_state(nfa, NFA_EPS);
+			nfa->states[*start].out=s1;
+			nfa->states[*start].out1=s2;
+			nfa->states[e1].out=(*end);
+			nfa->states[e2].out=(*end);
+			break;
+
+		case NODE_REPEAT:
+			//mandatory copies first...
+			(*start)=(*end)=nfa_new_state(nfa, NFA_EPS);
+			for(i=0; i<node->min; i++)
+			{
+				nfa_build(nfa, node->left, reverse, &s1, &e1);
+				nfa->states[*end].out=s1;
+				(*end)=e1;
+			}
+
+			//...then either a loop or optional copies
+			if(node->max==REPEAT_INFINITE)
+			{
+				nfa_build(nfa, node->left, reverse, &s1, &e1);
+				uint32_t split=nfa_new_state(nfa, NFA_SPLIT);
+				uint32_t exit=nfa_new_state(nfa, NFA_EPS);
+				nfa->states[*end].out=split;
+				nfa->states[split].out=s1;
+				nfa->states[split].out1=exit;
+				nfa->states[e1].out=split;
+				(*end)=exit;
+			}
+			else if(node->max>node->min)
+			{
+				uint32_t exit=nfa_new_state(nfa, NFA_EPS);
+				for(i=node->min; i<node->max; i++)
+				{
+					nfa_build(nfa, node->left, reverse, &s1, &e1);
+					uint32_t split=nfa_new_state(nfa, NFA_SPLIT);
+					nfa->states[*end].out=split;
+					nfa->states[split].out=s1;
+					nfa->states[split].out1=exit;
+					(*end)=e1;
+				}
+				nfa->states[*end].out=exit;
+				(*end)=exit;
+			}
+			break;
+	}
+}
+
+typedef struct
+{
+	nfa_t const * nfa;
+	uint32_t * stack;
+	uint32_t * mark; //generation of last visit per NFA state
+	uint32_t generation;
+} closure_t;
+
+//adds the epsilon-closure of state to list (only NFA_SET and NFA_MATCH states are kept, these are all that matter for the DFA)
+static void closure_add(closure_t * const cl, const uint32_t state, uint32_t * const list, uint_fast32_t * const nb)
+{
+	uint_fast32_t sp=0;
+
+	cl->stack[sp++]=state;
+	while(sp)
+	{
+		uint32_t s=cl->stack[--sp];
+		if(cl->mark[s]==cl->generation)
+			continue;
+		cl->mark[s]=cl->generation;
+
+		switch(cl->nfa->states[s].type)
+		{
+			case NFA_SET:
+			case NFA_MATCH:
+				list[(*nb)++]=s;
+				break;
+
+			case NFA_SPLIT:
+				cl->stack[sp++]=cl->nfa->states[s].out1;
+				//fall through
+			case NFA_EPS:
+				cl->stack[sp++]=cl->nfa->states[s].out;
+				break;
+		}
+	}
+}
+
+static int cmp_u32(void const * a, void const * b)
+{
+	uint32_t x=*(uint32_t const *)a;
+	uint32_t y=*(uint32_t const *)b;
+	return (x>y)-(x<y);
+}
+
+static uint32_t hash_set(uint32_t const * const list, const uint_fast32_t nb)
+{
+	uint32_t h=2166136261U;
+	uint_fast32_t i;
+	for(i=0; i<nb; i++)
+		h=(h^list[i])*16777619U;
+	return h;
+}
+
+static void compute_byte_classes(nfa_t const * const nfa, dfa_t * const dfa)
+{
+	uint_fast32_t i;
+	uint_fast16_t c;
+
+	memset(dfa->byte_class, 0, 256);
+	dfa->nb_classes=1;
+
+	for(i=0; i<nfa->nb_states; i++)
+	{
+		if(nfa->states[i].type!=NFA_SET)
+			continue;
+
+		uint64_t const * const set=nfa->nodes[nfa->states[i].node].set;
+		uint_fast16_t nb_total[256]={0}, nb_in[256]={0};
+		int_fast16_t new_class[256];
+
+		for(c=0; c<256; c++)
+		{
+			nb_total[dfa->byte_class[c]]++;
+			if(set_has(set, c))
+				nb_in[dfa->byte_class[c]]++;
+			new_class[c]=-1;
+		}
+
+		//split every class that is partially inside the set
+		for(c=0; c<256; c++)
+		{
+			uint8_t k=dfa->byte_class[c];
+			if(!set_has(set, c) || nb_in[k]==nb_total[k])
+				continue;
+			if(new_class[k]<0)
+				new_class[k]=dfa->nb_classes++;
+			dfa->byte_class[c]=new_class[k];
+		}
+	}
+}
+
+static void dfa_build(dfa_t * const dfa, nfa_t const * const nfa, const uint32_t nfa_start, const bool unanchored, char const * const pattern)
+{
+	closure_t cl;
+	uint32_t * pool=NULL; //all DFA state sets one after another
+	uint_fast32_t pool_size=0, pool_allocated=0;
+	uint_fast32_t * set_offset;
+	uint_fast32_t * set_nb;
+	uint32_t * hashtable;
+	uint32_t * list;
+	uint_fast32_t nb;
+	uint32_t * start_list;
+	uint_fast32_t start_nb=0;
+	bool * accept;
+	uint_fast32_t d, i;
+	uint_fast16_t k;
+
+	compute_byte_classes(nfa, dfa);
+
+	cl.nfa=nfa;
+	cl.stack=malloc((2*nfa->nb_states+1)*sizeof(uint32_t));
+	cl.mark=calloc(nfa->nb_states, sizeof(uint32_t));
+	cl.generation=0;
+	list=malloc(nfa->nb_states*sizeof(uint32_t));
+	start_list=malloc(nfa->nb_states*sizeof(uint32_t));
+	set_offset=malloc(REGEX_DFA_STATES_MAX*sizeof(uint_fast32_t));
+	set_nb=malloc(REGEX_DFA_STATES_MAX*sizeof(uint_fast32_t));
+	hashtable=calloc(DFA_HASHTABLE_SIZE, sizeof(uint32_t)); //0=empty slot, else DFA state+1
+	dfa->next=malloc(REGEX_DFA_STATES_MAX*dfa->nb_classes*sizeof(uint32_t));
+	accept=calloc(REGEX_DFA_STATES_MAX, sizeof(bool));
+	if(cl.stack==NULL || cl.mark==NULL || list==NULL || start_list==NULL || set_offset==NULL || set_nb==NULL || hashtable==NULL || dfa->next==NULL || accept==NULL)
+		err(1, "malloc for DFA construction failed");
+
+	cl.generation++;
+	closure_add(&cl, nfa_start, start_list, &start_nb);
+	qsort(start_list, start_nb, sizeof(uint32_t), cmp_u32);
+
+	//state 0: dead state (empty set), state 1: start
+	dfa->nb_states=0;
+	for(i=0; i<2; i++)
+	{
+		uint32_t const * const src=(i==0)?NULL:start_list;
+		nb=(i==0)?0:start_nb;
+
+		if(pool_size+nb>pool_allocated)
+		{
+			pool_allocated=2*(pool_size+nb)+1024;
+			pool=realloc(pool, pool_allocated*sizeof(uint32_t));
+			if(pool==NULL)
+				err(1, "realloc for DFA construction failed");
+		}
+		if(nb)
+			memcpy(pool+pool_size, src, nb*sizeof(uint32_t));
+		set_offset[i]=pool_size;
+		set_nb[i]=nb;
+		pool_size+=nb;
+
+		uint32_t h=hash_set(pool+set_offset[i], nb)%DFA_HASHTABLE_SIZE;
+		while(hashtable[h])
+			h=(h+1)%DFA_HASHTABLE_SIZE;
+		hashtable[h]=i+1;
+		dfa->nb_states++;
+	}
+
+	//subset construction, states are numbered in order of discovery so this is a BFS
+	for(d=0; d<dfa->nb_states; d++)
+	{
+		for(i=0; i<set_nb[d]; i++)
+		{
+			if(nfa->states[pool[set_offset[d]+i]].type==NFA_MATCH)
+				accept[d]=true;
+		}
+
+		for(k=0; k<dfa->nb_classes; k++)
+		{
+			uint_fast16_t c;
+			for(c=0; dfa->byte_class[c]!=k; c++); //representative byte of the class
+
+			cl.generation++;
+			nb=0;
+			for(i=0; i<set_nb[d]; i++)
+			{
+				nfastate_t const * const st=&nfa->states[pool[set_offset[d]+i]];
+				if(st->type==NFA_SET && set_has(nfa->nodes[st->node].set, c))
+					closure_add(&cl, st->out, list, &nb);
+			}
+			if(unanchored && d!=0)
+			{
+				for(i=0; i<start_nb; i++)
+				{
+					if(cl.mark[start_list[i]]!=cl.generation)
+					{
+						cl.mark[start_list[i]]=cl.generation;
+						list[nb++]=start_list[i];
+					}
+				}
+			}
+			qsort(list, nb, sizeof(uint32_t), cmp_u32);
+
+			uint32_t h=hash_set(list, nb)%DFA_HASHTABLE_SIZE;
+			uint32_t target=0;
+			while(hashtable[h])
+			{
+				uint32_t cand=hashtable[h]-1;
+				if(set_nb[cand]==nb && !memcmp(pool+set_offset[cand], list, nb*sizeof(uint32_t)))
+				{
+					target=cand;
+					break;
+				}
+				h=(h+1)%DFA_HASHTABLE_SIZE;
+			}
+
+			if(!hashtable[h])
+			{
+				if(dfa->nb_states==REGEX_DFA_STATES_MAX)
+					errx(1, "regex \"%s\" needs more than %u DFA states, please simplify it", pattern, REGEX_DFA_STATES_MAX);
+
+				if(pool_size+nb>pool_allocated)
+				{
+					pool_allocated=2*(pool_size+nb)+1024;
+					pool=realloc(pool, pool_allocated*sizeof(uint32_t));
+					if(pool==NULL)
+						err(1, "realloc for DFA construction failed");
+				}
+				memcpy(pool+pool_size, list, nb*sizeof(uint32_t));
+				set_offset[dfa->nb_states]=pool_size;
+				set_nb[dfa->nb_states]=nb;
+				pool_size+=nb;
+
+				target=dfa->nb_states++;
+				hashtable[h]=target+1;
+			}
+
+			dfa->next[d*dfa->nb_classes+k]=target;
+		}
+	}
+
+	dfa->next=realloc(dfa->next, dfa->nb_states*dfa->nb_classes*sizeof(uint32_t));
+	for(i=0; i<dfa->nb_states*dfa->nb_classes; i++)
+		dfa->next[i]=((dfa->next[i]*dfa->nb_classes)<<1)|accept[dfa->next[i]];
+	dfa->start=((1*dfa->nb_classes)<<1)|accept[1];
+	for(i=0; i<256; i++)
+		dfa->start_loop[i]=(dfa->next[1*dfa->nb_classes+dfa->byte_class[i]]==dfa->start);
+	
+	free(accept);
+
+	free(cl.stack);
+	free(cl.mark);
+	free(list);
+	free(start_list);
+	free(set_offset);
+	free(set_nb);
+	free(hashtable);
+	free(pool);
+}
+
+void regexdfa_compile(regexdfa_t * const re, char const * const pattern)
+{
+	parser_t ps={ pattern, pattern, NULL, 0 };
+	nfa_t nfa;
+	uint32_t start, end;
+	int32_t root;
+
+	memset(re, 0, sizeof(regexdfa_t));
+	re->pattern=strdup(pattern);
+	if(re->pattern==NULL)
+		err(1, "strdup for regex failed");
+
+	root=parse_alt(&ps);
+	if(*ps.p!='\0')
+		parse_error(&ps, "unbalanced )");
+
+	memset(&nfa, 0, sizeof(nfa_t));
+	nfa.nodes=ps.nodes;
+	nfa_new_state(&nfa, NFA_EPS); //keep 0 unused so an unpatched out is easy to spot
+
+	nfa_build(&nfa, root, false, &start, &end);
+	nfa.states[end].out=nfa_new_state(&nfa, NFA_MATCH);
+	dfa_build(&re->forward, &nfa, start, false, pattern);
+
+	if(re->forward.start&1)
+		errx(1, "regex \"%s\" matches the empty string", pattern);
+
+	nfa.nb_states=1;
+	nfa_build(&nfa, root, true, &start, &end);
+	nfa.states[end].out=nfa_new_state(&nfa, NFA_MATCH);
+	dfa_build(&re->reverse, &nfa, start, true, pattern);
+
+	free(nfa.states);
+	free(ps.nodes);
+}
+
+void regexdfa_search(regexdfa_t * const re, uint8_t const * const data, const uint_fast32_t len, regexdfa_callback_t callback, void * const userdata)
+{
+	dfa_t const * const rev=&re->reverse;
+	dfa_t const * const fwd=&re->forward;
+	uint_fast32_t i;
+	uint32_t state;
+
+	uint_fast32_t nb_starts=0;
+	uint_fast32_t last_end=0;
+
+	if(re->starts_size<len)
+	{
+		re->starts=realloc(re->starts, len*sizeof(uint32_t));
+		if(re->starts==NULL)
+			err(1, "realloc for regex scratch failed");
+		re->starts_size=len;
+	}
+
+	//one pass backwards finds every position where some match starts
+	state=rev->start;
+	i=len;
+	while(i>0)
+	{
+		if(state==rev->start)
+		{
+			//most of the time nothing is going on
+			while(i>0 && rev->start_loop[data[i-1]])
+				i--;
+			if(i==0)
+				break;
+		}
+
+		i--;
+		state=rev->next[(state>>1)+rev->byte_class[data[i]]];
+		if(state&1)
+			re->starts[nb_starts++]=i;
+	}
+
+	//then take the longest match from each start position (in ascending order), skipping over what was already matched
+	while(nb_starts--)
+	{
+		uint_fast32_t j;
+		uint_fast32_t match_end=0;
+		bool truncated=true;
+
+		i=re->starts[nb_starts];
+		if(i<last_end)
+			continue;
+
+		state=fwd->start;
+		for(j=i; j<len; j++)
+		{
+			state=fwd->next[(state>>1)+fwd->byte_class[data[j]]];
+			if(state==0) //dead state, can't be accepting
+			{
+				truncated=false;
+				break;
+			}
+			if(state&1)
+				match_end=j+1;
+		}
+
+		if(match_end)
+		{
+			callback(i, match_end, truncated, userdata);
+			last_end=match_end;
+		}
+	}
+}
+
+void regexdfa_free(regexdfa_t * const re)
+{
+	free(re->pattern);
+	free(re->forward.next);
+	free(re->reverse.next);
+	free(re->starts);
+
+	memset(re, 0, sizeof(regexdfa_t));
+}
@@ -0,0 +1,48 @@
+#ifndef __REGEXDFA_H__
+#define __REGEXDFA_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define REGEX_DFA_STATES_MAX 8192
+
+typedef struct
+{
+	uint_fast32_t nb_states; //state 0 is the dead state
+	uint_fast16_t nb_classes;
+	uint8_t byte_class[256]; //bytes that are never told apart by the regex share a column in the table
+	uint32_t * next; //nb_states*nb_classes entries, each is (target state*nb_classes)<<1 | target is accepting - saves a multiplication and a lookup per byte
+	uint32_t start; //same encoding
+	bool start_loop[256]; //bytes that don't leave the start state, can be skipped quickly
+} dfa_t;
+
+typedef struct
+{
+	char * pattern;
+	dfa_t reverse; //regex reversed and unanchored, run backwards over the block it tells at which positions a match starts
+	dfa_t forward; //anchored, run from a start position it gives the end of the longest match
+
+	uint32_t * starts; //scratch for regexdfa_search(), positions where a match starts
+	uint_fast32_t starts_size;
+} regexdfa_t;
+
+void regexdfa_compile(regexdfa_t * const re, char const * const pattern);
+
+//finds all leftmost-longest non-overlapping matches in data[0...len-1] and calls callback for each of them
+//truncated is true if the match could go on after data[len-1], ie it may be longer than match_end in a bigger buffer
+typedef void (*regexdfa_callback_t)(const uint_fast32_t match_start, const uint_fast32_t match_end, const bool truncated, void * const userdata);
+void regexdfa_search(regexdfa_t * const re, uint8_t const * const data, const uint_fast32_t len, regexdfa_callback_t callback, void * const userdata);
+
+void regexdfa_free(regexdfa_t * const re);
+
+#endif
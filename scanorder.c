@@ -0,0 +1,104 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "scanorder.h"
+
+/*
+This file is part of fsfuzz.
+
+The order in which the offsets are scanned. Sequential is the default. For --aligned-first every alignment is a multiple of the next one so a pass just skips the offsets the earlier passes have done. For --sample and --time-budget the offsets come from a permutation of [start, end) so the part scanned is spread over the whole dump, whenever the scan stops: an LCG with full period modulo a power of 2 (Hull-Dobell: odd increment, multiplier = 1 mod 4) followed by a bijective mix of the bits, values outside the range are skipped. It is seeded so a run can be repeated.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define LCG_MULTIPLIER 0x5851F42D4C957F2DULL
+#define MIX_MULTIPLIER 0x9E3779B97F4A7C15ULL //odd, so a bijection modulo any power of 2
+
+const uint_fast32_t scan_alignments[NB_SCAN_PASSES]={ 128*1024, 4096, 512, 1 };
+
+//smallest offset >=from that belongs to the current pass, offsets aligned to the alignment of an earlier pass have already been scanned
+static uint_fast32_t first_in_pass(scanorder_t const * const so, const uint_fast32_t from)
+{
+	const uint_fast32_t align=scan_alignments[so->pass];
+	uint_fast32_t pos=((from+align-1)/align)*align;
+	
+	if(so->pass>0 && (pos%scan_alignments[so->pass-1])==0)
+		pos+=align;
+	
+	return pos;
+}
+
+static uint64_t permute(scanorder_t const * const so, uint64_t x)
+{
+	x^=x>>so->shift;
+	x=(x*MIX_MULTIPLIER)&so->mask;
+	x^=x>>so->shift;
+	return x;
+}
+
+void scanorder_init(scanorder_t * const so, const order_t order, const uint_fast32_t start, const uint_fast32_t end, const uint64_t seed, const uint64_t nb_samples)
+{
+	so->order=order;
+	so->start=start;
+	so->end=end;
+	so->next=start;
+	so->pass=0;
+	
+	if(order==ORDER_ALIGNED_FIRST)
+		so->next=first_in_pass(so, start);
+	
+	if(order==ORDER_RANDOM)
+	{
+		uint_fast8_t nb_bits=1;
+		while(nb_bits<64 && (1ULL<<nb_bits)<(uint64_t)(end-start))
+			nb_bits++;
+		so->mask=(nb_bits<64)?((1ULL<<nb_bits)-1):UINT64_MAX;
+		so->shift=nb_bits/2+1;
+		so->increment=((seed*MIX_MULTIPLIER)|1)&so->mask;
+		so->state=(seed^(seed>>17))&so->mask;
+		so->nb_left=(nb_samples<(uint64_t)(end-start))?nb_samples:(uint64_t)(end-start);
+	}
+}
+
+uint_fast32_t scanorder_next(scanorder_t * const so)
+{
+	uint_fast32_t pos;
+	uint64_t x;
+	
+	switch(so->order)
+	{
+		case ORDER_SEQUENTIAL:
+			return (so->next<so->end)?so->next++:so->end;
+		
+		case ORDER_ALIGNED_FIRST:
+			while(so->next>=so->end && so->pass<NB_SCAN_PASSES-1)
+			{
+				so->pass++;
+				so->next=first_in_pass(so, so->start);
+			}
+			if(so->next>=so->end)
+				return so->end;
+			pos=so->next;
+			so->next=first_in_pass(so, pos+1);
+			return pos;
+		
+		case ORDER_RANDOM:
+			if(so->nb_left==0)
+				return so->end;
+			so->nb_left--;
+			do
+			{
+				so->state=(so->state*LCG_MULTIPLIER+so->increment)&so->mask;
+				x=permute(so, so->state);
+			} while(x>=(uint64_t)(so->end-so->start)); //less than half of the values are skipped
+			return so->start+x;
+	}
+	
+	return so->end;
+}
@@ -0,0 +1,50 @@
+#ifndef __SCANORDER_H__
+#define __SCANORDER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define NB_SCAN_PASSES 4
+
+typedef enum
+{
+	ORDER_SEQUENTIAL,
+	ORDER_ALIGNED_FIRST, //--aligned-first
+	ORDER_RANDOM //--sample and --time-budget
+} order_t;
+
+extern const uint_fast32_t scan_alignments[NB_SCAN_PASSES];
+
+typedef struct
+{
+	order_t order;
+	uint_fast32_t start;
+	uint_fast32_t end;
+	uint_fast32_t next;
+	
+	uint_fast8_t pass; //ORDER_ALIGNED_FIRST, index into scan_alignments
+	
+	//ORDER_RANDOM: LCG over the next power of 2 >= end-start, values outside are skipped
+	uint64_t mask;
+	uint_fast8_t shift;
+	uint64_t increment;
+	uint64_t state;
+	uint64_t nb_left;
+} scanorder_t;
+
+//nb_samples is only used for ORDER_RANDOM
+void scanorder_init(scanorder_t * const so, const order_t order, const uint_fast32_t start, const uint_fast32_t end, const uint64_t seed, const uint64_t nb_samples);
+//every offset in [start, end) is returned at most once, end means done
+uint_fast32_t scanorder_next(scanorder_t * const so);
+
+#endif
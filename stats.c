@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "stats.h"
+#include "magicdata.h"
+
+/*
+This file is part of fsfuzz.
+
+Where does the time go? Every phase of the work done at each offset is timed with clock_gettime(CLOCK_MONOTONIC), which doesn't need a syscall on Linux. All of this is only done with --stats.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+static char const * const phase_names[NB_PHASES]={ "memcpy", "user_decrypt_block", "entropy", "string search", "regex search", "magic search" };
+
+static uint64_t diff_ns(struct timespec const * const a, struct timespec const * const b)
+{
+	return (b->tv_sec-a->tv_sec)*1000000000UL+b->tv_nsec-a->tv_nsec;
+}
+
+void stats_init(stats_t * const stats)
+{
+	memset(stats, 0, sizeof(stats_t));
+	clock_gettime(CLOCK_MONOTONIC, &stats->start);
+	stats->last=stats->start;
+}
+
+void stats_offset_start(stats_t * const stats)
+{
+	stats->nb_offsets++;
+	clock_gettime(CLOCK_MONOTONIC, &stats->last);
+}
+
+void stats_phase_end(stats_t * const stats, const phase_t phase)
+{
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	stats->ns[phase]+=diff_ns(&stats->last, &now);
+	stats->last=now;
+}
+
+void stats_print(stats_t const * const stats, const uint_fast32_t blocksize)
+{
+	struct timespec now;
+	uint_fast32_t i;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	double total_s=diff_ns(&stats->start, &now)/1e9;
+	
+	printf("\nstatistics:\n");
+	printf("\toffsets scanned: %lu in %.3f s (%.0f offsets/s)\n", stats->nb_offsets, total_s, total_s>0?stats->nb_offsets/total_s:0);
+	
+	printf("\ttime per phase:\n");
+	for(i=0; i<NB_PHASES; i++)
+	{
+		if(stats->ns[i]==0)
+			continue;
+		printf("\t\t%-20s %10.3f s %5.1f%% %8.1f ns/offset\n", phase_names[i], stats->ns[i]/1e9, total_s>0?100.0*stats->ns[i]/1e9/total_s:0, stats->nb_offsets?(double)stats->ns[i]/stats->nb_offsets:0);
+	}
+	
+	if(stats->ns[PHASE_DECRYPT])
+		printf("\tdecryption: %.1f MB/s\n", (double)stats->nb_offsets*blocksize/(stats->ns[PHASE_DECRYPT]/1e9)/1e6);
+	
+	printf("\tmagic entries (level 0 evaluated / passed / valid / invalid):\n");
+	for(i=0; i<NB_ENTRIES_MAGIC; i++)
+	{
+		if(stats->magic_evaluated[i]==0)
+			continue;
+		printf("\t\t#%-3lu %10lu %10lu %8lu %8lu  %s\n", i, stats->magic_evaluated[i], stats->magic_passed[i], stats->magic_valid[i], stats->magic_invalid[i], magic[i].tests[0].message);
+	}
+}
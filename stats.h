@@ -0,0 +1,49 @@
+#ifndef __STATS_H__
+#define __STATS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "magicdata_constants.h"
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+typedef enum
+{
+	PHASE_MEMCPY,
+	PHASE_DECRYPT,
+	PHASE_ENTROPY,
+	PHASE_STRINGS, //--string and --strings-file
+	PHASE_REGEX,
+	PHASE_MAGIC,
+	NB_PHASES
+} phase_t;
+
+typedef struct
+{
+	uint64_t nb_offsets;
+	uint64_t ns[NB_PHASES];
+	struct timespec start; //of the scan
+	struct timespec last; //end of the last phase
+	
+	uint64_t magic_evaluated[NB_ENTRIES_MAGIC]; //level 0 test done
+	uint64_t magic_passed[NB_ENTRIES_MAGIC]; //level 0 test succeeded
+	uint64_t magic_valid[NB_ENTRIES_MAGIC];
+	uint64_t magic_invalid[NB_ENTRIES_MAGIC];
+} stats_t;
+
+void stats_init(stats_t * const stats);
+void stats_offset_start(stats_t * const stats); //call once per offset before the first phase
+void stats_phase_end(stats_t * const stats, const phase_t phase); //time since the end of the last phase is accounted to phase
+void stats_print(stats_t const * const stats, const uint_fast32_t blocksize);
+
+#endif
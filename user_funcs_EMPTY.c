@@ -20,3 +20,22 @@ void user_decrypt_cleanup(void)
 	
 }
 
+
+/*
+Optional, only used by --extract: decrypt len bytes of a filesystem, pos is the position of data[0] counted from the start of the filesystem. The function is called for consecutive chunks of at most 1MB.
+If you don't provide it --extract calls user_decrypt_block() on each chunk (with --position-independent) or on each blocksize bytes.
+
+void user_decrypt_stream(uint8_t * const data, const uint_fast32_t len, const uint64_t pos)
+{
+	
+}
+*/
+
+/*
+Optional, only used by --cache: a string that changes with everything user_decrypt_block() depends on that is not compiled in, for example a key that user_decrypt_init() reads from a file. Leave it out if the key is in this file.
+
+char const * user_decrypt_identity(void)
+{
+	
+}
+*/
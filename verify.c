@@ -0,0 +1,246 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "verify.h"
+#include "magicdata.h"
+
+/*
+This file is part of fsfuzz.
+
+Second-stage verification of magic hits. The shallow tests in the magic-database let a lot of random data through, but most filesystem headers carry a checksum or fields that must be consistent with each other. This is only run on hits so it doesn't need to be fast, but CRC32 is still done with slice-by-8 tables to keep UBIFS nodes (up to 4kB) cheap.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define UBI_CRC32_INIT 0xFFFFFFFF
+#define UBI_EC_HDR_SIZE 64
+#define UBI_VID_HDR_SIZE 64
+#define UBI_HDR_CRC_OFFSET 60
+#define JFFS2_HDR_SIZE 12
+#define JFFS2_HDR_CRC_OFFSET 8
+#define UBIFS_CH_SIZE 24
+#define UBIFS_NODE_SIZE_MAX 4096
+#define SQUASHFS_SB_SIZE 96
+#define EXT_SB_OFFSET 0x400
+
+char const * const verify_status_names[]={ "unverified", "verified", "rejected" };
+
+typedef enum
+{
+	KIND_NONE,
+	KIND_JFFS2_LE,
+	KIND_JFFS2_BE,
+	KIND_UBI_EC,
+	KIND_UBI_VID,
+	KIND_UBIFS,
+	KIND_SQUASHFS_LE,
+	KIND_SQUASHFS_BE,
+	KIND_EXT
+} kind_t;
+
+static uint32_t crc_table[8][256];
+static kind_t kind[NB_ENTRIES_MAGIC];
+
+static void crc32_init_table(void)
+{
+	uint_fast16_t i;
+	uint_fast8_t j;
+
+	for(i=0; i<256; i++)
+	{
+		uint32_t c=i;
+		for(j=0; j<8; j++)
+			c=(c&1)?(0xEDB88320^(c>>1)):(c>>1);
+		crc_table[0][i]=c;
+	}
+
+	for(i=0; i<256; i++)
+	{
+		for(j=1; j<8; j++)
+			crc_table[j][i]=(crc_table[j-1][i]>>8)^crc_table[0][crc_table[j-1][i]&0xff];
+	}
+}
+
+uint32_t crc32_le(uint32_t crc, uint8_t const * const data, const uint_fast32_t len)
+{
+	uint_fast32_t i=0;
+
+	//8 bytes per step, each table gives the contribution of one byte position
+	for(; i+8<=len; i+=8)
+	{
+		uint32_t lo=crc^(data[i]|(data[i+1]<<8)|(data[i+2]<<16)|((uint32_t)data[i+3]<<24));
+		uint32_t hi=data[i+4]|(data[i+5]<<8)|(data[i+6]<<16)|((uint32_t)data[i+7]<<24);
+		crc=crc_table[7][lo&0xff]^crc_table[6][(lo>>8)&0xff]^crc_table[5][(lo>>16)&0xff]^crc_table[4][lo>>24]^
+			crc_table[3][hi&0xff]^crc_table[2][(hi>>8)&0xff]^crc_table[1][(hi>>16)&0xff]^crc_table[0][hi>>24];
+	}
+
+	for(; i<len; i++)
+		crc=(crc>>8)^crc_table[0][(crc^data[i])&0xff];
+
+	return crc;
+}
+
+static uint32_t read_le32(uint8_t const * const p)
+{
+	return p[0]|(p[1]<<8)|(p[2]<<16)|((uint32_t)p[3]<<24);
+}
+
+static uint32_t read_be32(uint8_t const * const p)
+{
+	return ((uint32_t)p[0]<<24)|(p[1]<<16)|(p[2]<<8)|p[3];
+}
+
+static uint64_t read_64(uint8_t const * const p, const bool big_endian)
+{
+	if(big_endian)
+		return ((uint64_t)read_be32(p)<<32)|read_be32(p+4);
+	else
+		return ((uint64_t)read_le32(p+4)<<32)|read_le32(p);
+}
+
+static bool string_is(test_t const * const test, char const * const str)
+{
+	return test->data_type==DATA_STRING && test->string.nb_bytes==strlen(str) && !memcmp(test->string.bytes, str, test->string.nb_bytes);
+}
+
+static void kind_init_table(void)
+{
+	uint_fast32_t i;
+
+	for(i=0; i<NB_ENTRIES_MAGIC; i++)
+	{
+		test_t const * const test=&magic[i].tests[0];
+
+		if(!strncmp(test->message, "JFFS2 ", 6))
+			kind[i]=(test->endian==ENDIAN_BE)?KIND_JFFS2_BE:KIND_JFFS2_LE;
+		else if(string_is(test, "UBI#"))
+			kind[i]=KIND_UBI_EC;
+		else if(string_is(test, "UBI!"))
+			kind[i]=KIND_UBI_VID;
+		else if(!strncmp(test->message, "UBIFS ", 6))
+			kind[i]=KIND_UBIFS;
+		else if(string_is(test, "hsqs"))
+			kind[i]=KIND_SQUASHFS_LE;
+		else if(string_is(test, "sqsh"))
+			kind[i]=KIND_SQUASHFS_BE;
+		else if(!strncmp(test->message, "Linux EXT ", 10))
+			kind[i]=KIND_EXT;
+		else
+			kind[i]=KIND_NONE;
+	}
+}
+
+static void verify_init_tables(void)
+{
+	crc32_init_table();
+	kind_init_table();
+}
+
+void verify_init(void)
+{
+	static pthread_once_t once=PTHREAD_ONCE_INIT;
+
+	//host programs may call fsfuzz_init() from several threads at once
+	pthread_once(&once, verify_init_tables);
+}
+
+static verify_status_t verify_jffs2(uint8_t const * const data, const uint_fast32_t len, const bool big_endian)
+{
+	if(len<JFFS2_HDR_SIZE)
+		return VERIFY_UNVERIFIED;
+
+	uint32_t crc_stored=big_endian?read_be32(&data[JFFS2_HDR_CRC_OFFSET]):read_le32(&data[JFFS2_HDR_CRC_OFFSET]);
+
+	return (crc32_le(0, data, JFFS2_HDR_CRC_OFFSET)==crc_stored)?VERIFY_VERIFIED:VERIFY_REJECTED;
+}
+
+//EC and VID header have the same size and the CRC at the same place
+static verify_status_t verify_ubi(uint8_t const * const data, const uint_fast32_t len, const uint_fast32_t hdr_size)
+{
+	if(len<hdr_size)
+		return VERIFY_UNVERIFIED;
+
+	return (crc32_le(UBI_CRC32_INIT, data, UBI_HDR_CRC_OFFSET)==read_be32(&data[UBI_HDR_CRC_OFFSET]))?VERIFY_VERIFIED:VERIFY_REJECTED;
+}
+
+static verify_status_t verify_ubifs(uint8_t const * const data, const uint_fast32_t len)
+{
+	if(len<UBIFS_CH_SIZE)
+		return VERIFY_UNVERIFIED;
+
+	uint32_t node_len=read_le32(&data[16]);
+
+	if(node_len<UBIFS_CH_SIZE || node_len>UBIFS_NODE_SIZE_MAX)
+		return VERIFY_REJECTED;
+
+	if(node_len>len)
+		return VERIFY_UNVERIFIED;
+
+	return (crc32_le(UBI_CRC32_INIT, &data[8], node_len-8)==read_le32(&data[4]))?VERIFY_VERIFIED:VERIFY_REJECTED;
+}
+
+//there is no checksum in a squashfs superblock, but for version 4 the fields must be consistent
+static verify_status_t verify_squashfs(uint8_t const * const data, const uint_fast32_t len, const bool big_endian)
+{
+	if(len<SQUASHFS_SB_SIZE)
+		return VERIFY_UNVERIFIED;
+
+	uint16_t major=big_endian?(data[28]<<8|data[29]):(data[29]<<8|data[28]);
+	if(major!=4)
+		return VERIFY_UNVERIFIED;
+
+	uint32_t block_size=big_endian?read_be32(&data[12]):read_le32(&data[12]);
+	uint16_t block_log=big_endian?(data[22]<<8|data[23]):(data[23]<<8|data[22]);
+	uint64_t bytes_used=read_64(&data[40], big_endian);
+	uint64_t id_table_start=read_64(&data[48], big_endian);
+	uint64_t inode_table_start=read_64(&data[64], big_endian);
+	uint64_t directory_table_start=read_64(&data[72], big_endian);
+
+	if(block_size<4096 || block_size>(1<<20) || (block_size&(block_size-1)) || block_log!=__builtin_ctz(block_size))
+		return VERIFY_REJECTED;
+
+	if(bytes_used<SQUASHFS_SB_SIZE || inode_table_start<SQUASHFS_SB_SIZE || inode_table_start>directory_table_start || directory_table_start>=bytes_used || id_table_start>=bytes_used)
+		return VERIFY_REJECTED;
+
+	return VERIFY_VERIFIED;
+}
+
+verify_status_t verify_hit(uint8_t const * const data, const uint_fast32_t len, const uint_fast32_t ind_magic)
+{
+	switch(kind[ind_magic])
+	{
+		case KIND_JFFS2_LE: return verify_jffs2(data, len, false);
+		case KIND_JFFS2_BE: return verify_jffs2(data, len, true);
+		case KIND_UBI_EC: return verify_ubi(data, len, UBI_EC_HDR_SIZE);
+		case KIND_UBI_VID: return verify_ubi(data, len, UBI_VID_HDR_SIZE);
+		case KIND_UBIFS: return verify_ubifs(data, len);
+		case KIND_SQUASHFS_LE: return verify_squashfs(data, len, false);
+		case KIND_SQUASHFS_BE: return verify_squashfs(data, len, true);
+		default: return VERIFY_UNVERIFIED;
+	}
+}
+
+uint64_t verify_fs_size(uint8_t const * const data, const uint_fast32_t len, const uint_fast32_t ind_magic)
+{
+	switch(kind[ind_magic])
+	{
+		case KIND_EXT:
+			if(len<EXT_SB_OFFSET+0x1c)
+				return 0;
+			uint32_t log_block_size=read_le32(&data[EXT_SB_OFFSET+0x18]);
+			if(log_block_size>6) //64kB blocks max
+				return 0;
+			return (uint64_t)read_le32(&data[EXT_SB_OFFSET+0x04])<<(10+log_block_size); //s_blocks_count<<(10+s_log_block_size)
+		
+		default:
+			return 0;
+	}
+}
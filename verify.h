@@ -0,0 +1,38 @@
+#ifndef __VERIFY_H__
+#define __VERIFY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+typedef enum
+{
+	VERIFY_UNVERIFIED, //no check for this kind of hit or header not entirely inside the block
+	VERIFY_VERIFIED,
+	VERIFY_REJECTED
+} verify_status_t;
+
+extern char const * const verify_status_names[];
+
+//builds the tables used by the functions below, must be called before any of them (fsfuzz_init() does it), thread-safe
+void verify_init(void);
+
+//reflected CRC32 with polynomial 0xEDB88320 (like zlib) but without the final inversion, as used by JFFS2 and UBI
+uint32_t crc32_le(uint32_t crc, uint8_t const * const data, const uint_fast32_t len);
+
+//second-stage check of a hit of magic[ind_magic] at the start of data (decrypted block of len bytes)
+verify_status_t verify_hit(uint8_t const * const data, const uint_fast32_t len, const uint_fast32_t ind_magic);
+
+//size of the filesystem in bytes for kinds where it can't be expressed with a {size:} tag in the magic-database (ext), 0 if unknown
+uint64_t verify_fs_size(uint8_t const * const data, const uint_fast32_t len, const uint_fast32_t ind_magic);
+
+#endif
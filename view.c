@@ -0,0 +1,229 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <err.h>
+
+#include "view.h"
+
+/*
+This file is part of fsfuzz.
+
+Views of the input file for the scan. A raw NAND dump has the spare area (OOB) of each page right after the page, so a filesystem is cut into pieces of one page and tests of the magic-database at 0x410 or 32768 never see the right bytes. With --nand-layout the scan sees the pages only, one after another, without a copy of the whole file: the block is gathered page by page from the file when it is filled, which is the copy that is done for every offset anyway.
+
+Dumps read from a 16 bit NOR bus often have the bytes of each word swapped and boards with two chips for one bus interleave them byte- or wordwise. --swap16, --swap32 and --deinterleave undo this while the block is filled. Unlike pages, this is a byte by byte gather and doing it for every byte of every block would take far longer than the scan itself, so a window of the transformed data is kept and blocks are copied from it as long as the offsets go up one by one.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+typedef struct
+{
+	char const * name;
+	uint_fast32_t page_size;
+	uint_fast32_t oob_size;
+} nand_preset_t;
+
+static const nand_preset_t nand_presets[]=
+{
+	{ "512",	512,	16 }, //small page
+	{ "2k",		2048,	64 },
+	{ "2k128",	2048,	128 },
+	{ "4k",		4096,	224 },
+	{ "4k256",	4096,	256 },
+	{ "8k",		8192,	448 },
+};
+
+bool view_parse_nand_layout(char const * const str, uint_fast32_t * const page_size, uint_fast32_t * const oob_size)
+{
+	size_t i;
+	char c;
+
+	for(i=0; i<sizeof(nand_presets)/sizeof(nand_preset_t); i++)
+	{
+		if(!strcmp(str, nand_presets[i].name))
+		{
+			(*page_size)=nand_presets[i].page_size;
+			(*oob_size)=nand_presets[i].oob_size;
+			return true;
+		}
+	}
+
+	return sscanf(str, "%lu,%lu%c", page_size, oob_size, &c)==2 && (*page_size)>0;
+}
+
+void view_init(view_t * const view, uint8_t const * const data, const size_t raw_size, const uint_fast32_t page_size, const uint_fast32_t oob_size)
+{
+	memset(view, 0, sizeof(view_t));
+
+	view->data=data;
+	view->raw_size=raw_size;
+	view->page_size=page_size;
+	view->oob_size=oob_size;
+
+	if(page_size)
+	{
+		const size_t rest=raw_size%(page_size+oob_size); //a last page without (complete) OOB
+		view->size=(raw_size/(page_size+oob_size))*page_size+((rest<page_size)?rest:page_size);
+	}
+	else
+		view->size=raw_size;
+}
+
+void view_init_swap(view_t * const view, uint8_t const * const data, const size_t raw_size, const uint_fast32_t width)
+{
+	view_init(view, data, raw_size, 0, 0);
+
+	view->transform=TRANSFORM_SWAP;
+	view->width=width;
+	view->size=raw_size-raw_size%width; //an incomplete last word can't be swapped
+	snprintf(view->name, SZ_VIEW_NAME, "swap%lu", 8*width);
+}
+
+void view_init_chip(view_t * const view, uint8_t const * const data, const size_t raw_size, const uint_fast32_t nb_chips, const uint_fast32_t width, const uint_fast32_t chip)
+{
+	const size_t nb_units=raw_size/width;
+
+	view_init(view, data, raw_size, 0, 0);
+
+	view->transform=TRANSFORM_CHIP;
+	view->width=width;
+	view->nb_chips=nb_chips;
+	view->chip=chip;
+	view->size=((nb_units>chip)?((nb_units-chip+nb_chips-1)/nb_chips):0)*width;
+	snprintf(view->name, SZ_VIEW_NAME, "chip %lu/%lu", chip, nb_chips);
+}
+
+size_t view_raw_offset(view_t const * const view, const size_t offset)
+{
+	if(view->page_size==0)
+		return offset;
+
+	return (offset/view->page_size)*(view->page_size+view->oob_size)+offset%view->page_size;
+}
+
+static void transform(view_t const * const view, uint8_t * const dest, const size_t offset, const size_t len)
+{
+	size_t i=0;
+
+	if(view->transform==TRANSFORM_SWAP)
+	{
+		//width is a power of 2, the position inside the word is reversed by the xor
+		for(; i<len && (offset+i)%view->width; i++)
+			dest[i]=view->data[(offset+i)^(view->width-1)];
+
+		if(view->width==2)
+		{
+			for(; i+2<=len; i+=2)
+			{
+				uint16_t w;
+				memcpy(&w, view->data+offset+i, 2);
+				w=__builtin_bswap16(w);
+				memcpy(dest+i, &w, 2);
+			}
+		}
+		else
+		{
+			for(; i+4<=len; i+=4)
+			{
+				uint32_t w;
+				memcpy(&w, view->data+offset+i, 4);
+				w=__builtin_bswap32(w);
+				memcpy(dest+i, &w, 4);
+			}
+		}
+
+		for(; i<len; i++)
+			dest[i]=view->data[(offset+i)^(view->width-1)];
+	}
+	else
+	{
+		const size_t stride=view->nb_chips*view->width;
+		uint8_t const * src=view->data+((offset/view->width)*view->nb_chips+view->chip)*view->width;
+		size_t pos=offset%view->width;
+
+		if(view->width==1)
+		{
+			for(; i<len; i++)
+				dest[i]=src[i*stride];
+			return;
+		}
+
+		for(; i<len; i++)
+		{
+			dest[i]=src[pos];
+			if(++pos==view->width)
+			{
+				pos=0;
+				src+=stride;
+			}
+		}
+	}
+}
+
+void view_read(view_t * const view, uint8_t * const dest, const size_t offset, const size_t len)
+{
+	size_t done, n;
+
+	if(view->transform!=TRANSFORM_NONE)
+	{
+		const bool sequential=(offset>=view->window_start && offset<=view->window_start+view->window_len) || offset==view->last_offset+1;
+		view->last_offset=offset;
+
+		if(offset+len<=view->window_start+view->window_len && offset>=view->window_start)
+		{
+			memcpy(dest, view->window+(offset-view->window_start), len);
+			return;
+		}
+
+		//only worth it if the next blocks are read too
+		if(!sequential)
+		{
+			transform(view, dest, offset, len);
+			return;
+		}
+
+		n=len+VIEW_WINDOW_SIZE;
+		if(n>view->size-offset)
+			n=view->size-offset;
+		if(n>view->sz_window)
+		{
+			view->window=realloc(view->window, n);
+			if(view->window==NULL)
+				err(1, "realloc for view window failed");
+			view->sz_window=n;
+		}
+		transform(view, view->window, offset, n);
+		view->window_start=offset;
+		view->window_len=n;
+
+		memcpy(dest, view->window, len);
+		return;
+	}
+
+	if(view->page_size==0)
+	{
+		memcpy(dest, view->data+offset, len);
+		return;
+	}
+
+	for(done=0; done<len; done+=n)
+	{
+		n=view->page_size-(offset+done)%view->page_size;
+		if(n>len-done)
+			n=len-done;
+		memcpy(dest+done, view->data+view_raw_offset(view, offset+done), n);
+	}
+}
+
+void view_free(view_t * const view)
+{
+	free(view->window);
+	view->window=NULL;
+	view->sz_window=0;
+	view->window_len=0;
+}
@@ -0,0 +1,69 @@
+#ifndef __VIEW_H__
+#define __VIEW_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+This file is part of fsfuzz.
+
+(c) 2023 by kittennbfive
+
+https://github.com/kittennbfive
+
+AGPLv3+ and NO WARRANTY!
+*/
+
+#define NB_CHIPS_MAX 8
+#define NB_VIEWS_MAX (NB_CHIPS_MAX+3) //file as it is, --swap16, --swap32 and one per chip of --deinterleave
+#define SZ_VIEW_NAME 16
+#define VIEW_WINDOW_SIZE (1<<20)
+
+typedef enum
+{
+	TRANSFORM_NONE,
+	TRANSFORM_SWAP, //--swap16 and --swap32
+	TRANSFORM_CHIP //--deinterleave
+} transform_t;
+
+//how the scan sees the input file, offsets of the view are not necessarily those of the file
+typedef struct
+{
+	uint8_t const * data; //entire input file
+	size_t raw_size;
+	size_t size; //of the view
+	char name[SZ_VIEW_NAME]; //shown with the results, empty for the file as it is and --nand-layout
+
+	//--nand-layout, 0 for none: the file is made of pages of page_size bytes each followed by oob_size bytes that are left out
+	uint_fast32_t page_size;
+	uint_fast32_t oob_size;
+
+	transform_t transform;
+	uint_fast32_t width; //TRANSFORM_SWAP: bytes per word (power of 2), TRANSFORM_CHIP: bytes per chip before the next chip follows
+	uint_fast32_t nb_chips;
+	uint_fast32_t chip;
+
+	//transformed data from window_start on, see view_read()
+	uint8_t * window;
+	size_t sz_window;
+	size_t window_start;
+	size_t window_len;
+	size_t last_offset;
+} view_t;
+
+//"$page,$oob" or the name of a preset, returns false if str is neither
+bool view_parse_nand_layout(char const * const str, uint_fast32_t * const page_size, uint_fast32_t * const oob_size);
+
+void view_init(view_t * const view, uint8_t const * const data, const size_t raw_size, const uint_fast32_t page_size, const uint_fast32_t oob_size);
+//the bytes of each word of width bytes in reverse order
+void view_init_swap(view_t * const view, uint8_t const * const data, const size_t raw_size, const uint_fast32_t width);
+//the bytes of chip (0...nb_chips-1) of a dump where the chips follow each other every width bytes
+void view_init_chip(view_t * const view, uint8_t const * const data, const size_t raw_size, const uint_fast32_t nb_chips, const uint_fast32_t width, const uint_fast32_t chip);
+//copies len bytes of the view starting at offset to dest
+void view_read(view_t * const view, uint8_t * const dest, const size_t offset, const size_t len);
+//offset in the file of a byte of --nand-layout, for the other views the offset in the view: a swapped word or the bytes of a chip have no single place in the file
+size_t view_raw_offset(view_t const * const view, const size_t offset);
+void view_free(view_t * const view);
+
+#endif